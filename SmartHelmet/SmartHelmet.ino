@@ -1,13 +1,15 @@
 #include "config.h"
 #include "mpu6050.h"
 #include "imu_filters.h"
-//#include "crash_detector.h"  // Old threshold-based detector
-#include "ml_crash_detector.h"  // New ML-based detector
+#include "detector_manager.h"  // Production + shadow detectors (see config.h)
 #include "state_machine.h"
 #include "mqtt_manager.h"
 #include "led.h"
 #include "button.h"
 #include "data_logger.h"
+#include "telemetry.h"
+#include "spectral_features.h"
+#include "golden_check.h"
 #define DEBUG 1
 
 void setup() {
@@ -18,15 +20,18 @@ void setup() {
   initLED();
   initButton();
   initDataLogger();
-  initMLCrashDetector();  // Initialize ML detector
+  initDetectors();  // Initialize production and shadow detectors
+  initSpectralFeatures();
+  initTelemetry();
 
   initStateMachine();
-  Serial.println("System ready - ML-based accident detection active");
+  Serial.println("System ready - " + String(getProductionDetectorName()) + " accident detection active");
   Serial.println("Send START:label or STOP for data collection");
 }
 
 void loop() {
   updateIMU();
+  updateSpectralFeatures();
   
   // Handle Serial commands for data collection
   if (Serial.available() > 0) {
@@ -47,14 +52,19 @@ void loop() {
         Serial.println("STATUS:IDLE");
       }
     }
+    else if (command.startsWith("GOLDEN:")) {
+      handleGoldenCommand(command);
+    }
   }
   
   // Log sensor data if collecting
   if (isCollecting()) {
-    logSensorSample();
+    logSensorSamples();
   } else {
     // Normal operation mode
     updateStateMachine();
     handleMQTT();
+    updateTelemetry();  // after events, so it never delays a crash publish
+    updateShadowDetectors();  // last: only uses what is left of the loop
   }
 }
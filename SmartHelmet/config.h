@@ -3,6 +3,7 @@
 
 // IMU
 #define IMU_SAMPLE_RATE 100   // Hz
+#define IMU_SAMPLE_INTERVAL_MS (1000 / IMU_SAMPLE_RATE)
 
 // Crash thresholds
 #define ACCEL_WARN_G     3.0
@@ -12,9 +13,52 @@
 #define TILT_THRESHOLD_DEG 60
 #define TILT_TIME_MS     2000
 
+// Vibration rejection (spectral_features.h): a window whose accel energy sits
+// mostly above the body-motion band is treated as road buzz / helmet knocks.
+// Off until the thresholds below are tuned on recorded edge_case rides
+// (helmet-host-tools score_corpus --spectral); a knock is broadband, so it
+// is not what this catches. Overridable for A/B runs in the host scorer.
+#ifndef SPECTRAL_KNOCK_REJECT
+#define SPECTRAL_KNOCK_REJECT 0
+#endif
+#define SPECTRAL_LOW_SHARE_MIN 0.2   // below this low-band share -> vibration
+#define SPECTRAL_MIN_ENERGY    0.05  // g^2; quieter windows are not judged
+
+// Detector selection (detector_manager.cpp). The production detector drives
+// the state machine; shadow detectors run on the same samples and only log
+// disagreements. A detector cannot be production and shadow at once.
+#define PRODUCTION_DETECTOR multiResDetector
+#define FALLBACK_DETECTOR   thresholdDetector  // if production fails to init
+#define SHADOW_ENABLED      1
+#define SHADOW_DETECTORS    &mlDetector, &thresholdDetector, &impactDetector  // comma-separated list
+#define SHADOW_BUDGET_US    2000  // max shadow work per loop
+#define SHADOW_MAX_SAMPLES  8     // samples one shadow may consume per loop
+#define SHADOW_SHED_LOOP_MS 40    // skip shadows when loop() is slower than this
+#define SHADOW_AGREE_MS     1000  // triggers this close together agree
+
 // Cancel window
 #define CANCEL_WINDOW_MS 10000
 
+// Multi-resolution detector: how much post-impact context the 2 s stage sees
+// before it confirms or withdraws an alert raised by the onset stage
+#define CONTEXT_CONFIRM_MS 1000
+
+// A detector alert stays local (LED, cancel button) until the detector's review
+// has confirmed it, so a context downgrade never reaches the server or the
+// app. If no verdict comes by then (e.g. the context window is still filling
+// after power-up), ACCIDENT_PENDING is published anyway.
+#define PENDING_HOLD_MS (CONTEXT_CONFIRM_MS + 500)
+
+// Live telemetry stream (set to 0 to disable)
+#define TELEMETRY_ENABLED 1
+
+// GOLDEN: Serial commands for the on-device model check (ml-data/golden_serial.py).
+// Test builds only: reading a window stalls loop() for about a second, so a
+// stray GOLDEN:BEGIN on a riding helmet would pause crash detection.
+#ifndef GOLDEN_SERIAL_ENABLED
+#define GOLDEN_SERIAL_ENABLED 0
+#endif
+
 // BLE
 #define BLE_DEVICE_NAME "SmartHelmet"
 
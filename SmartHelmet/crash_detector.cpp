@@ -1,5 +1,5 @@
 #include "crash_detector.h"
-#include "mpu6050.h"
+#include "sample_ring.h"
 #include "imu_filters.h"
 #include "config.h"
 #include <math.h>
@@ -10,37 +10,71 @@
 
 static float confidence = 0.0;
 static unsigned long cooldownUntil = 0;
+static SampleCursor sampleCursor;
+static bool cursorReady = false;
+
+bool initCrashDetector() {
+  confidence = 0.0;
+  cooldownUntil = 0;
+  initSampleCursor(sampleCursor);
+  cursorReady = true;
+  return true;
+}
 
 bool crashCandidateDetected() {
 
-  // Cooldown after previous crash
-  if (millis() < cooldownUntil) return false;
+  if (!cursorReady) {
+    initSampleCursor(sampleCursor);
+    cursorReady = true;
+  }
+
+  // Cooldown after previous crash: drop samples taken during it
+  if (millis() < cooldownUntil) {
+    initSampleCursor(sampleCursor);
+    return false;
+  }
 
-  float ax = getAx();
-  float ay = getAy();
-  float az = getAz();
+  // Score every sample since the last call, once each
+  ImuSample s;
+  while (readSample(sampleCursor, s)) {
+    float A = sqrt(s.ax*s.ax + s.ay*s.ay + s.az*s.az);
+    float pitch = fabs(pitchFrom(s.ax, s.ay, s.az));
+    float roll  = fabs(rollFrom(s.ax, s.ay, s.az));
 
-  float A = sqrt(ax*ax + ay*ay + az*az);
-  float pitch = fabs(getPitch());
-  float roll  = fabs(getRoll());
+    // Decay old confidence
+    confidence *= CONFIDENCE_DECAY;
 
-  // Decay old confidence
-  confidence *= CONFIDENCE_DECAY;
+    if (A > ACCEL_CRASH_G) confidence += 0.4;
+    if (pitch > TILT_THRESHOLD_DEG || roll > TILT_THRESHOLD_DEG) confidence += 0.4;
+    if (A > HARD_IMPACT_G) confidence = 1.0;
 
-  if (A > ACCEL_CRASH_G) confidence += 0.4;
-  if (pitch > TILT_THRESHOLD_DEG || roll > TILT_THRESHOLD_DEG) confidence += 0.4;
-  if (A > HARD_IMPACT_G) confidence = 1.0;
+    confidence = constrain(confidence, 0.0, 1.0);
 
-  confidence = constrain(confidence, 0.0, 1.0);
+    if (confidence >= CONFIDENCE_TRIGGER) return true;
+  }
 
-  return confidence >= CONFIDENCE_TRIGGER;
+  return false;
 }
 
 float getCrashConfidence() {
   return confidence;
 }
 
+const CrashDetectorOps thresholdDetector = {
+  "threshold", initCrashDetector, crashCandidateDetected, getCrashConfidence, resetCrashDetector, nullptr,
+  resumeCrashDetector, &sampleCursor
+};
+
 void resetCrashDetector() {
   confidence = 0.0;
   cooldownUntil = millis() + CRASH_COOLDOWN_MS;
+  initSampleCursor(sampleCursor);
+  cursorReady = true;
+}
+
+// Re-seat on the newest samples; unlike reset() no cooldown
+void resumeCrashDetector() {
+  confidence = 0.0;
+  initSampleCursor(sampleCursor);
+  cursorReady = true;
 }
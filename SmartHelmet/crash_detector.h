@@ -1,9 +1,14 @@
 #ifndef CRASH_DETECTOR_H
 #define CRASH_DETECTOR_H
 #include <Arduino.h>
+#include "detector.h"
 
+bool initCrashDetector();
 bool crashCandidateDetected();
 float getCrashConfidence();
 void resetCrashDetector();
+void resumeCrashDetector();
+
+extern const CrashDetectorOps thresholdDetector;
 
 #endif
@@ -1,15 +1,20 @@
 #include "data_logger.h"
-#include "mpu6050.h"
+#include "config.h"
+#include "sample_ring.h"
+#include "pipeline.h"
 #include "imu_filters.h"
+#include "mpu6050.h"
 
 // Data collection state
 static bool collecting = false;
 static String currentLabel = "";
 static unsigned long sessionStartTime = 0;
 static int sampleCount = 0;
-static unsigned long lastSampleTime = 0;
+static RateGate gate;  // logs at the model rate (ModelShape)
+static SampleCursor sampleCursor;
+static unsigned long missedAtStart = 0;
 
-#define SAMPLE_INTERVAL_MS 20  // 50Hz sampling rate
+static void logSample(const ImuSample& s);
 
 void initDataLogger() {
   collecting = false;
@@ -28,7 +33,9 @@ void startDataCollection(String label) {
   currentLabel = label;
   sessionStartTime = millis();
   sampleCount = 0;
-  lastSampleTime = 0;
+  resetRateGate(gate);
+  initSampleCursor(sampleCursor);
+  missedAtStart = getMissedSamples();
   
   // Print CSV header
   Serial.println("DATA_LOGGER:START:" + label);
@@ -42,34 +49,41 @@ void stopDataCollection() {
   }
   
   collecting = false;
-  Serial.println("DATA_LOGGER:STOP:Samples=" + String(sampleCount));
+  // Dropped: samples the logger fell too far behind to read (ring overruns).
+  // Missed: sample periods the IMU never read because loop() was late.
+  // Both count IMU_SAMPLE_RATE samples, not logged rows.
+  Serial.println("DATA_LOGGER:STOP:Samples=" + String(sampleCount) +
+                 ":Dropped=" + String(sampleCursor.overruns) +
+                 ":Missed=" + String(getMissedSamples() - missedAtStart));
   
   currentLabel = "";
   sampleCount = 0;
 }
 
-void logSensorSample() {
+void logSensorSamples() {
   if (!collecting) return;
   
-  // Enforce sampling rate
-  unsigned long now = millis();
-  if (now - lastSampleTime < SAMPLE_INTERVAL_MS) {
-    return;
+  ImuSample s;
+  while (readSample(sampleCursor, s)) {
+    // Enforce sampling rate
+    if (!acceptSample<ModelShape>(gate, s)) continue;
+    logSample(s);
   }
-  lastSampleTime = now;
-  
-  // Get sensor data
-  float ax = getAx();
-  float ay = getAy();
-  float az = getAz();
-  float gx = getGx();
-  float gy = getGy();
-  float gz = getGz();
-  float pitch = getPitch();
-  float roll = getRoll();
+}
+
+// Write one sample as a CSV row
+static void logSample(const ImuSample& s) {
+  float ax = s.ax;
+  float ay = s.ay;
+  float az = s.az;
+  float gx = s.gx;
+  float gy = s.gy;
+  float gz = s.gz;
+  float pitch = pitchFrom(ax, ay, az);
+  float roll = rollFrom(ax, ay, az);
   
   // Calculate timestamp relative to session start
-  unsigned long timestamp = now - sessionStartTime;
+  unsigned long timestamp = s.timestampMs - sessionStartTime;
   
   // Output CSV row
   Serial.print(timestamp);
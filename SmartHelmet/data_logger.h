@@ -12,8 +12,8 @@ void startDataCollection(String label);
 // Stop data collection
 void stopDataCollection();
 
-// Log a single sensor sample
-void logSensorSample();
+// Log every new sample from the shared sample ring (50Hz)
+void logSensorSamples();
 
 // Check if currently collecting
 bool isCollecting();
@@ -0,0 +1,33 @@
+#ifndef DETECTOR_H
+#define DETECTOR_H
+
+#include "sample_ring.h"
+
+// Second opinion on the last trigger from a multi-stage detector
+enum DetectorVerdict {
+    VERDICT_PENDING,     // still collecting context
+    VERDICT_CONFIRMED,
+    VERDICT_DOWNGRADED   // context says it was not a crash
+};
+
+// Common interface of the crash detectors, so the state machine (production)
+// and shadow evaluation (detector_manager.h) can use any of them.
+// Each detector reads the shared sample ring through its own cursor.
+struct CrashDetectorOps {
+    const char* name;
+    bool (*init)();          // false if the detector cannot run (reason on Serial)
+    bool (*detect)();        // consume new samples; true when a crash is detected
+    float (*confidence)();   // 0.0-1.0
+    void (*reset)();         // called after every trigger
+    // Optional (nullptr = every trigger is final). Called while the alert is
+    // pending; keeps consuming samples and reviews the last trigger.
+    DetectorVerdict (*review)();
+    // Optional (nullptr = reset). Start over from the newest samples after an
+    // idle spell, without the post-trigger cooldown reset() may start.
+    void (*resume)();
+    // The cursor detect() reads, so a caller can cap a call's samples
+    // (limitCursorReads()) and see where the detector is in the stream
+    SampleCursor* cursor;
+};
+
+#endif
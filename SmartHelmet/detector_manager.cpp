@@ -0,0 +1,324 @@
+#include "detector_manager.h"
+#include "config.h"
+#include "sample_ring.h"
+#include "crash_detector.h"
+#include "ml_crash_detector.h"
+#include "impact_detector.h"
+#include "multires_detector.h"
+#include "mqtt_manager.h"
+#include <Arduino.h>
+
+// Samples kept per disagreement: the 1 s the firing detector read last, at
+// 100Hz. Covers the impact (500 ms) and onset (80 ms) windows; the model's
+// 2 s window is longer than the ring (SAMPLE_RING_SIZE), so only its newest
+// half is kept.
+#define SHADOW_SNAPSHOT 100
+#define REPORT_LINES_PER_LOOP 2  // Serial lines per loop while reporting
+
+static const CrashDetectorOps* production = &PRODUCTION_DETECTOR;
+
+#if SHADOW_ENABLED
+static const CrashDetectorOps* const shadows[] = { SHADOW_DETECTORS };
+#define SHADOW_COUNT (int)(sizeof(shadows) / sizeof(shadows[0]))
+#endif
+
+// One comparison per shadow. While open, one side has fired and the other has
+// SHADOW_AGREE_MS to follow; if it does not, the comparison is reported a few
+// lines per loop so Serial never blocks the loop for long.
+struct Comparison {
+    bool open;
+    bool reporting;
+    int reportLine;       // next line to print while reporting
+    bool productionFired;
+    unsigned long time;
+    float productionConfidence;
+    float shadowConfidence;
+    int sampleCount;
+    ImuSample samples[SHADOW_SNAPSHOT];
+};
+
+#if SHADOW_ENABLED
+static Comparison comparisons[SHADOW_COUNT];
+static bool shadowActive[SHADOW_COUNT];
+static unsigned long lastShadowTrigger[SHADOW_COUNT];
+#endif
+
+static unsigned long lastProductionTrigger = 0;
+static bool productionTriggered = false;
+static unsigned long lastProductionEval = 0;
+static bool shadowsIdle = true;
+static unsigned long lastShadowLoop = 0;
+static unsigned long shedCount = 0;
+static int nextShadow = 0;
+
+// ---------------------------------------------------------------------------
+// Disagreement reporting
+// ---------------------------------------------------------------------------
+
+static void snapshotSamples(Comparison& c, const CrashDetectorOps& fired) {
+    // Oldest first, ending with the last sample the firing detector read (a
+    // shadow may be behind the ring's newest). Slots from before the first
+    // write or already overwritten are skipped by peekSample().
+    uint32_t end = fired.cursor ? fired.cursor->next : nextSampleSeq();
+    uint32_t start = end - SHADOW_SNAPSHOT;
+    c.sampleCount = 0;
+    for (uint32_t seq = start; seq != end; seq++) {
+        if (peekSample(seq, c.samples[c.sampleCount])) {
+            c.sampleCount++;
+        }
+    }
+}
+
+static void openComparison(int i, bool productionFired, float shadowConfidence) {
+#if SHADOW_ENABLED
+    Comparison& c = comparisons[i];
+    if (c.open || c.reporting) return;  // keep the first one
+    c.open = true;
+    c.productionFired = productionFired;
+    c.time = millis();
+    c.productionConfidence = production->confidence();
+    c.shadowConfidence = shadowConfidence;
+    snapshotSamples(c, productionFired ? *production : *shadows[i]);
+#endif
+}
+
+static void publishDisagreement(int i) {
+#if SHADOW_ENABLED
+    Comparison& c = comparisons[i];
+    const char* firedBy = c.productionFired ? "production" : "shadow";
+
+    char payload[256];
+    snprintf(payload, sizeof(payload),
+      "{"
+        "\"type\":\"SHADOW_DISAGREE\","
+        "\"helmetId\":\"H001\","
+        "\"production\":\"%s\","
+        "\"shadow\":\"%s\","
+        "\"firedBy\":\"%s\","
+        "\"timestamp\":%lu,"
+        "\"productionConfidence\":%.2f,"
+        "\"shadowConfidence\":%.2f,"
+        "\"samples\":%d,"
+        "\"shed\":%lu"
+      "}",
+      production->name, shadows[i]->name, firedBy, c.time,
+      c.productionConfidence, c.shadowConfidence, c.sampleCount, shedCount
+    );
+    publishShadowReport(payload);
+#endif
+}
+
+// Full record on Serial for offline review:
+//   SHADOW:DISAGREE:<shadow>,<firedBy>,<ms>,<productionConf>,<shadowConf>
+//   SHADOW:SAMPLE:<ms>,ax,ay,az,gx,gy,gz   (oldest first)
+//   SHADOW:END
+static void printReportLines(int i) {
+#if SHADOW_ENABLED
+    Comparison& c = comparisons[i];
+    for (int n = 0; n < REPORT_LINES_PER_LOOP && c.reporting; n++, c.reportLine++) {
+        if (c.reportLine == 0) {
+            Serial.print("SHADOW:DISAGREE:");
+            Serial.print(shadows[i]->name);
+            Serial.print(",");
+            Serial.print(c.productionFired ? "production" : "shadow");
+            Serial.print(",");
+            Serial.print(c.time);
+            Serial.print(",");
+            Serial.print(c.productionConfidence, 2);
+            Serial.print(",");
+            Serial.println(c.shadowConfidence, 2);
+        } else if (c.reportLine <= c.sampleCount) {
+            const ImuSample& s = c.samples[c.reportLine - 1];
+            Serial.print("SHADOW:SAMPLE:");
+            Serial.print(s.timestampMs);
+            Serial.print(","); Serial.print(s.ax, 4);
+            Serial.print(","); Serial.print(s.ay, 4);
+            Serial.print(","); Serial.print(s.az, 4);
+            Serial.print(","); Serial.print(s.gx, 4);
+            Serial.print(","); Serial.print(s.gy, 4);
+            Serial.print(","); Serial.println(s.gz, 4);
+        } else {
+            Serial.println("SHADOW:END");
+            c.reporting = false;
+        }
+    }
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Production
+// ---------------------------------------------------------------------------
+
+void initDetectors() {
+    if (!production->init()) {
+        // e.g. the ML model does not match the compiled pipeline shape
+        Serial.print("Production detector ");
+        Serial.print(production->name);
+        Serial.println(" failed to start, falling back");
+        production = &FALLBACK_DETECTOR;
+        production->init();
+    }
+#if SHADOW_ENABLED
+    for (int i = 0; i < SHADOW_COUNT; i++) {
+        // Detectors keep their state in file statics: one role each
+        shadowActive[i] = shadows[i] != production;
+        if (!shadowActive[i]) {
+            Serial.print("SHADOW: skipping ");
+            Serial.print(shadows[i]->name);
+            Serial.println(" (it is the production detector)");
+            continue;
+        }
+        shadowActive[i] = shadows[i]->init();
+        comparisons[i].open = false;
+        comparisons[i].reporting = false;
+        lastShadowTrigger[i] = 0;
+    }
+#endif
+    Serial.print("Production detector: ");
+    Serial.println(production->name);
+}
+
+bool productionCrashDetected() {
+    bool detected = production->detect();
+    lastProductionEval = millis();
+    if (!detected) return false;
+
+    lastProductionTrigger = lastProductionEval;
+    productionTriggered = true;
+#if SHADOW_ENABLED
+    for (int i = 0; i < SHADOW_COUNT; i++) {
+        if (!shadowActive[i]) continue;
+        bool shadowAgreed = lastShadowTrigger[i] != 0 &&
+                            lastProductionTrigger - lastShadowTrigger[i] <= SHADOW_AGREE_MS;
+        if (comparisons[i].open && !comparisons[i].productionFired) {
+            comparisons[i].open = false;  // shadow fired first, production followed
+        } else if (!shadowAgreed) {
+            openComparison(i, true, shadows[i]->confidence());
+        }
+    }
+#endif
+    return true;
+}
+
+// Not an evaluation for the shadows: they stay idle while an alert is
+// pending, so a shadow re-firing on the same event is not a disagreement
+DetectorVerdict reviewProductionTrigger() {
+    if (!production->review) return VERDICT_CONFIRMED;
+    return production->review();
+}
+
+float getProductionConfidence() {
+    return production->confidence();
+}
+
+void resetProductionDetector() {
+    production->reset();
+}
+
+const char* getProductionDetectorName() {
+    return production->name;
+}
+
+// ---------------------------------------------------------------------------
+// Shadows
+// ---------------------------------------------------------------------------
+
+static void runShadow(int i) {
+#if SHADOW_ENABLED
+    const CrashDetectorOps& d = *shadows[i];
+    // The budget is only checked between shadows: bound each one's catch-up
+    limitCursorReads(*d.cursor, SHADOW_MAX_SAMPLES);
+    bool detected = d.detect();
+    limitCursorReads(*d.cursor, -1);
+    if (!detected) return;
+
+    unsigned long now = millis();
+    float confidence = d.confidence();
+    lastShadowTrigger[i] = now;
+    bool productionAgreed = productionTriggered && now - lastProductionTrigger <= SHADOW_AGREE_MS;
+    if (comparisons[i].open && comparisons[i].productionFired) {
+        comparisons[i].open = false;  // production fired first, shadow followed
+    } else if (!productionAgreed) {
+        openComparison(i, false, confidence);
+    }
+    // Treat the shadow like the state machine treats production. After
+    // openComparison(): reset() may move the cursor the snapshot ends at.
+    d.reset();
+#endif
+}
+
+static void closeExpiredComparisons(unsigned long now) {
+#if SHADOW_ENABLED
+    for (int i = 0; i < SHADOW_COUNT; i++) {
+        Comparison& c = comparisons[i];
+        if (c.open && now - c.time > SHADOW_AGREE_MS) {
+            // The other side never followed
+            c.open = false;
+            c.reporting = true;
+            c.reportLine = 0;
+            publishDisagreement(i);
+        }
+    }
+#endif
+}
+
+static void printReports() {
+#if SHADOW_ENABLED
+    for (int i = 0; i < SHADOW_COUNT; i++) {
+        if (comparisons[i].reporting) printReportLines(i);
+    }
+#endif
+}
+
+void updateShadowDetectors() {
+#if SHADOW_ENABLED
+    unsigned long now = millis();
+
+    // Under load shadow work goes first; shadows catch up from the ring later
+    unsigned long loopGap = now - lastShadowLoop;
+    lastShadowLoop = now;
+    if (loopGap > SHADOW_SHED_LOOP_MS) {
+        shedCount++;
+        return;
+    }
+
+    unsigned long start = micros();
+    closeExpiredComparisons(now);
+
+    // Production is not being evaluated (crash pending or data collection):
+    // there is nothing to compare against
+    if (lastProductionEval == 0 || now - lastProductionEval > SHADOW_AGREE_MS) {
+        shadowsIdle = true;
+        printReports();
+        return;
+    }
+    if (shadowsIdle) {
+        // Start from the same samples production sees now. resume, not
+        // reset: a cooldown here would hide the shadow's next trigger.
+        for (int i = 0; i < SHADOW_COUNT; i++) {
+            if (!shadowActive[i]) continue;
+            if (shadows[i]->resume) shadows[i]->resume();
+            else shadows[i]->reset();
+        }
+        shadowsIdle = false;
+    }
+
+    for (int k = 0; k < SHADOW_COUNT; k++) {
+        if (micros() - start >= SHADOW_BUDGET_US) {
+            shedCount++;
+            return;
+        }
+        int i = (nextShadow + k) % SHADOW_COUNT;
+        if (shadowActive[i]) runShadow(i);
+    }
+    nextShadow = (nextShadow + 1) % SHADOW_COUNT;
+
+    if (micros() - start < SHADOW_BUDGET_US) {
+        printReports();
+    }
+#endif
+}
+
+unsigned long getShadowShedCount() {
+    return shedCount;
+}
@@ -0,0 +1,31 @@
+#ifndef DETECTOR_MANAGER_H
+#define DETECTOR_MANAGER_H
+
+#include "detector.h"
+
+// Production detector + shadow evaluation.
+//
+// The production detector (PRODUCTION_DETECTOR in config.h) is what the state
+// machine uses; if it fails to initialize, FALLBACK_DETECTOR takes its place. Shadow detectors (SHADOW_DETECTORS) see the same samples,
+// but only when there is CPU to spare: they are the first thing shed when
+// loop() runs late, and their work per loop is capped at SHADOW_BUDGET_US.
+// When only one side triggers within SHADOW_AGREE_MS, the disagreement
+// (time, both confidences, the samples leading up to it) is written to Serial
+// and a summary is published on helmet/H001/shadow.
+
+void initDetectors();
+
+// Production detector, used by the state machine
+bool productionCrashDetected();
+DetectorVerdict reviewProductionTrigger();  // while the alert is pending
+float getProductionConfidence();
+void resetProductionDetector();
+const char* getProductionDetectorName();
+
+// Run shadow detectors within the budget; call once per loop()
+void updateShadowDetectors();
+
+// Number of loops in which shadow work was skipped or cut short
+unsigned long getShadowShedCount();
+
+#endif
@@ -0,0 +1,134 @@
+#include "feature_kernels.h"
+#include <math.h>
+
+#ifdef FEATURE_KERNELS_ESP_DSP
+#include <esp_dsp.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Scalar reference path
+// ---------------------------------------------------------------------------
+
+void magnitude3Scalar(const float* x, const float* y, const float* z, float* out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = sqrtf(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]);
+    }
+}
+
+void normalizeIntoScalar(const float* in, float* out, int n, float mean, float scale) {
+    for (int i = 0; i < n; i++) {
+        out[i] = (in[i] - mean) / scale;
+    }
+}
+
+void minMaxScalar(const float* v, int n, float* outMin, float* outMax) {
+    float lo = v[0];
+    float hi = v[0];
+    for (int i = 1; i < n; i++) {
+        if (v[i] < lo) lo = v[i];
+        if (v[i] > hi) hi = v[i];
+    }
+    *outMin = lo;
+    *outMax = hi;
+}
+
+float dotProductScalar(const float* a, const float* b, int n) {
+    float sum = 0.0f;
+    for (int i = 0; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+float sumOfScalar(const float* v, int n) {
+    float sum = 0.0f;
+    for (int i = 0; i < n; i++) {
+        sum += v[i];
+    }
+    return sum;
+}
+
+#ifdef FEATURE_KERNELS_SCALAR
+
+void magnitude3(const float* x, const float* y, const float* z, float* out, int n) {
+    magnitude3Scalar(x, y, z, out, n);
+}
+
+void normalizeInto(const float* in, float* out, int n, float mean, float scale) {
+    normalizeIntoScalar(in, out, n, mean, scale);
+}
+
+void minMax(const float* v, int n, float* outMin, float* outMax) {
+    minMaxScalar(v, n, outMin, outMax);
+}
+
+float dotProduct(const float* a, const float* b, int n) {
+    return dotProductScalar(a, b, n);
+}
+
+float sumOf(const float* v, int n) {
+    return sumOfScalar(v, n);
+}
+
+#else
+
+// ---------------------------------------------------------------------------
+// Optimized path
+// ---------------------------------------------------------------------------
+
+#ifdef FEATURE_KERNELS_ESP_DSP
+
+// esp-dsp has no fused x*x + y*y, so square/accumulate in small blocks
+#define DSP_BLOCK 32
+
+void magnitude3(const float* x, const float* y, const float* z, float* out, int n) {
+    float tmp[DSP_BLOCK];
+    for (int base = 0; base < n; base += DSP_BLOCK) {
+        int len = (n - base < DSP_BLOCK) ? (n - base) : DSP_BLOCK;
+        dsps_mul_f32(x + base, x + base, out + base, len, 1, 1, 1);
+        dsps_mul_f32(y + base, y + base, tmp, len, 1, 1, 1);
+        dsps_add_f32(out + base, tmp, out + base, len, 1, 1, 1);
+        dsps_mul_f32(z + base, z + base, tmp, len, 1, 1, 1);
+        dsps_add_f32(out + base, tmp, out + base, len, 1, 1, 1);
+    }
+    for (int i = 0; i < n; i++) {
+        out[i] = sqrtf(out[i]);
+    }
+}
+
+void normalizeInto(const float* in, float* out, int n, float mean, float scale) {
+    dsps_addc_f32(in, out, n, -mean, 1, 1);
+    dsps_mulc_f32(out, out, n, 1.0f / scale, 1, 1);
+}
+
+float dotProduct(const float* a, const float* b, int n) {
+    float sum = 0.0f;
+    dsps_dotprod_f32(a, b, &sum, n);
+    return sum;
+}
+
+#else
+
+void magnitude3(const float* x, const float* y, const float* z, float* out, int n) {
+    magnitude3Loop(x, y, z, out, n);
+}
+
+void normalizeInto(const float* in, float* out, int n, float mean, float scale) {
+    normalizeLoop(in, out, n, mean, scale);
+}
+
+float dotProduct(const float* a, const float* b, int n) {
+    return dotProductLanes(a, b, n);
+}
+
+#endif  // FEATURE_KERNELS_ESP_DSP
+
+void minMax(const float* v, int n, float* outMin, float* outMax) {
+    minMaxLanes(v, n, outMin, outMax);
+}
+
+float sumOf(const float* v, int n) {
+    return sumOfLanes(v, n);
+}
+
+#endif  // FEATURE_KERNELS_SCALAR
@@ -0,0 +1,189 @@
+#ifndef FEATURE_KERNELS_H
+#define FEATURE_KERNELS_H
+
+#include <math.h>
+
+// CONFIG_IDF_TARGET_* comes from sdkconfig.h. Include it here so every
+// translation unit sees the same target and picks the same kernel bodies,
+// whatever it included first.
+#if defined(__has_include)
+#if __has_include(<sdkconfig.h>)
+#include <sdkconfig.h>
+#endif
+#endif
+
+// Batch kernels over contiguous float arrays (one array per sensor axis).
+//
+// The default path is plain loops written so GCC/Clang auto-vectorize them on
+// x86/ARM hosts. On the ESP32-S3 the esp-dsp SIMD routines are used when the
+// library is available. Define FEATURE_KERNELS_SCALAR to force the reference
+// path everywhere (useful when checking the optimized kernels).
+
+#if !defined(FEATURE_KERNELS_SCALAR) && defined(CONFIG_IDF_TARGET_ESP32S3) && defined(__has_include)
+#if __has_include(<esp_dsp.h>)
+#define FEATURE_KERNELS_ESP_DSP 1
+#endif
+#endif
+
+// out[i] = sqrt(x[i]^2 + y[i]^2 + z[i]^2)
+void magnitude3(const float* x, const float* y, const float* z, float* out, int n);
+
+// out[i] = (in[i] - mean) / scale  (in and out may be the same array)
+void normalizeInto(const float* in, float* out, int n, float mean, float scale);
+
+// Smallest and largest element of v
+void minMax(const float* v, int n, float* outMin, float* outMax);
+
+// Sum of a[i] * b[i]
+float dotProduct(const float* a, const float* b, int n);
+
+// Sum of v[i]
+float sumOf(const float* v, int n);
+
+// Scalar reference versions, always available
+void magnitude3Scalar(const float* x, const float* y, const float* z, float* out, int n);
+void normalizeIntoScalar(const float* in, float* out, int n, float mean, float scale);
+void minMaxScalar(const float* v, int n, float* outMin, float* outMax);
+float dotProductScalar(const float* a, const float* b, int n);
+float sumOfScalar(const float* v, int n);
+
+// ---------------------------------------------------------------------------
+// Portable bodies, shared by the functions above and the fixed-length forms
+// ---------------------------------------------------------------------------
+// Reductions keep KERNEL_LANES independent accumulators so the compiler can
+// map them onto vector registers without -ffast-math reordering the sum.
+
+#define KERNEL_LANES 8
+
+#if defined(__GNUC__)
+#define KERNEL_RESTRICT __restrict__
+#else
+#define KERNEL_RESTRICT
+#endif
+
+inline void magnitude3Loop(const float* KERNEL_RESTRICT x, const float* KERNEL_RESTRICT y,
+                           const float* KERNEL_RESTRICT z, float* KERNEL_RESTRICT out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = sqrtf(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]);
+    }
+}
+
+inline void normalizeLoop(const float* in, float* out, int n, float mean, float scale) {
+    float inv = 1.0f / scale;
+    for (int i = 0; i < n; i++) {
+        out[i] = (in[i] - mean) * inv;
+    }
+}
+
+inline void minMaxLanes(const float* v, int n, float* outMin, float* outMax) {
+    if (n < KERNEL_LANES) {
+        minMaxScalar(v, n, outMin, outMax);
+        return;
+    }
+    float lo[KERNEL_LANES], hi[KERNEL_LANES];
+    for (int k = 0; k < KERNEL_LANES; k++) {
+        lo[k] = v[k];
+        hi[k] = v[k];
+    }
+    int i = KERNEL_LANES;
+    for (; i + KERNEL_LANES <= n; i += KERNEL_LANES) {
+        for (int k = 0; k < KERNEL_LANES; k++) {
+            float x = v[i + k];
+            lo[k] = x < lo[k] ? x : lo[k];
+            hi[k] = x > hi[k] ? x : hi[k];
+        }
+    }
+    float l = lo[0], h = hi[0];
+    for (int k = 1; k < KERNEL_LANES; k++) {
+        if (lo[k] < l) l = lo[k];
+        if (hi[k] > h) h = hi[k];
+    }
+    for (; i < n; i++) {
+        if (v[i] < l) l = v[i];
+        if (v[i] > h) h = v[i];
+    }
+    *outMin = l;
+    *outMax = h;
+}
+
+inline float dotProductLanes(const float* KERNEL_RESTRICT a, const float* KERNEL_RESTRICT b, int n) {
+    float acc[KERNEL_LANES] = {0};
+    int i = 0;
+    for (; i + KERNEL_LANES <= n; i += KERNEL_LANES) {
+        for (int k = 0; k < KERNEL_LANES; k++) {
+            acc[k] += a[i + k] * b[i + k];
+        }
+    }
+    float sum = 0.0f;
+    for (int k = 0; k < KERNEL_LANES; k++) sum += acc[k];
+    for (; i < n; i++) sum += a[i] * b[i];
+    return sum;
+}
+
+inline float sumOfLanes(const float* v, int n) {
+    float acc[KERNEL_LANES] = {0};
+    int i = 0;
+    for (; i + KERNEL_LANES <= n; i += KERNEL_LANES) {
+        for (int k = 0; k < KERNEL_LANES; k++) {
+            acc[k] += v[i + k];
+        }
+    }
+    float sum = 0.0f;
+    for (int k = 0; k < KERNEL_LANES; k++) sum += acc[k];
+    for (; i < n; i++) sum += v[i];
+    return sum;
+}
+
+// ---------------------------------------------------------------------------
+// Fixed-length forms for compile-time pipeline shapes (pipeline.h)
+// ---------------------------------------------------------------------------
+// Inlined with N as a constant: remainder loops fold away and short windows
+// unroll completely. esp-dsp routines take the length at run time anyway, so
+// on the S3 those kernels just forward.
+
+template <int N>
+inline void magnitude3N(const float* x, const float* y, const float* z, float* out) {
+#if defined(FEATURE_KERNELS_SCALAR) || defined(FEATURE_KERNELS_ESP_DSP)
+    magnitude3(x, y, z, out, N);
+#else
+    magnitude3Loop(x, y, z, out, N);
+#endif
+}
+
+template <int N>
+inline void normalizeIntoN(const float* in, float* out, float mean, float scale) {
+#if defined(FEATURE_KERNELS_SCALAR) || defined(FEATURE_KERNELS_ESP_DSP)
+    normalizeInto(in, out, N, mean, scale);
+#else
+    normalizeLoop(in, out, N, mean, scale);
+#endif
+}
+
+template <int N>
+inline void minMaxN(const float* v, float* outMin, float* outMax) {
+#ifdef FEATURE_KERNELS_SCALAR
+    minMaxScalar(v, N, outMin, outMax);
+#else
+    minMaxLanes(v, N, outMin, outMax);
+#endif
+}
+
+template <int N>
+inline float dotProductN(const float* a, const float* b) {
+#if defined(FEATURE_KERNELS_SCALAR) || defined(FEATURE_KERNELS_ESP_DSP)
+    return dotProduct(a, b, N);
+#else
+    return dotProductLanes(a, b, N);
+#endif
+}
+
+template <int N>
+inline float sumOfN(const float* v) {
+#ifdef FEATURE_KERNELS_SCALAR
+    return sumOfScalar(v, N);
+#else
+    return sumOfLanes(v, N);
+#endif
+}
+
+#endif
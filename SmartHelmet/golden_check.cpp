@@ -0,0 +1,64 @@
+#include "golden_check.h"
+#include "config.h"
+#include "pipeline.h"
+#include "ml_crash_detector.h"
+
+#if GOLDEN_SERIAL_ENABLED
+static SampleWindow<ModelShape> window;
+static float input[ModelShape::WINDOW_SIZE][ModelShape::FEATURES];
+
+static void runWindow(const String& id) {
+    // Same path as the detectors: input tensor, then the model. The model
+    // alone: the spectral gate is firmware-only, the notebook has no such step
+    unsigned long start = micros();
+    normalizeModelInput(window, input);
+    float confidence = runModelCore(window);
+    unsigned long elapsed = micros() - start;
+
+    Serial.print("GOLDEN:RESULT:");
+    Serial.print(id);
+    Serial.print(",");
+    Serial.print(confidence, 6);
+    Serial.print(",");
+    Serial.println(elapsed);
+}
+
+// The rows follow BEGIN back to back, faster than loop() comes around, so the
+// whole window is read here (the rest of the loop waits, ~1 s per window)
+static void readWindow() {
+    resetSampleWindow(window);
+    for (int rows = 0; rows < ModelShape::WINDOW_SIZE; rows++) {
+        String line = Serial.readStringUntil('\n');
+        line.trim();
+        ImuSample s = {};
+        if (!line.startsWith("GOLDEN:ROW:") ||
+            sscanf(line.c_str() + 11, "%f,%f,%f,%f,%f,%f",
+                   &s.ax, &s.ay, &s.az, &s.gx, &s.gy, &s.gz) != 6) {
+            Serial.print("GOLDEN:ERROR:bad row ");
+            Serial.println(rows);
+            return;
+        }
+        pushSample(window, s);
+    }
+
+    String run = Serial.readStringUntil('\n');
+    run.trim();
+    if (!run.startsWith("GOLDEN:RUN:")) {
+        Serial.println("GOLDEN:ERROR:expected RUN after the window");
+        return;
+    }
+    runWindow(run.substring(11));
+}
+#endif
+
+void handleGoldenCommand(const String& command) {
+#if GOLDEN_SERIAL_ENABLED
+    if (command == "GOLDEN:BEGIN") {
+        readWindow();
+    } else {
+        Serial.println("GOLDEN:ERROR:expected BEGIN");
+    }
+#else
+    Serial.println("GOLDEN:ERROR:disabled (GOLDEN_SERIAL_ENABLED)");
+#endif
+}
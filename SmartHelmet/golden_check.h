@@ -0,0 +1,21 @@
+#ifndef GOLDEN_CHECK_H
+#define GOLDEN_CHECK_H
+
+#include <Arduino.h>
+
+// On-device half of the golden-vector check: ml-data/golden_serial.py sends
+// windows exported by the training notebook and compares the replies with
+// the notebook's outputs (helmet-host-tools/check_model does the same on the
+// host). Serial protocol, one line each:
+//   GOLDEN:BEGIN                   start a new window, followed by
+//   GOLDEN:ROW:ax,ay,az,gx,gy,gz   ModelShape::WINDOW_SIZE raw samples, oldest first
+//   GOLDEN:RUN:<id>                -> GOLDEN:RESULT:<id>,<confidence>,<micros>
+// Errors are answered with GOLDEN:ERROR:<reason>. <micros> covers the input
+// tensor and runModelCore(), the model without the firmware's spectral gate,
+// so the result compares with the notebook's model.
+// Only compiled in with GOLDEN_SERIAL_ENABLED (config.h, off by default):
+// reading a window blocks loop() for about a second.
+
+void handleGoldenCommand(const String& command);
+
+#endif
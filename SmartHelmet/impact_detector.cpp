@@ -0,0 +1,71 @@
+#include "impact_detector.h"
+#include "config.h"
+#include "pipeline.h"
+#include "spectral_features.h"
+
+#define IMPACT_GYRO_DPS 200     // rotation that usually comes with a real fall
+#define IMPACT_VARIANCE 1.0     // g^2, sustained jolt rather than a single spike
+
+static WindowStage<ImpactShape> stage;
+static float lastConfidence = 0.0;
+
+bool initImpactDetector() {
+    resetImpactDetector();
+    Serial.println("Impact Detector initialized");
+    return true;
+}
+
+float scoreImpactFeatures(const WindowFeatures& f) {
+    float confidence = 0.0;
+    if (f.maxAccel > HARD_IMPACT_G) {
+        confidence += 0.5;
+    }
+    if (f.maxAccel > ACCEL_CRASH_G) {
+        confidence += 0.2;
+    }
+    if (f.maxGyro > IMPACT_GYRO_DPS) {
+        confidence += 0.2;
+    }
+    if (f.accelVariance > IMPACT_VARIANCE) {
+        confidence += 0.1;
+    }
+    return constrain(confidence, 0.0, 1.0);
+}
+
+static float scoreWindow() {
+    if (!stage.window.full) {
+        return 0.0;
+    }
+
+    WindowFeatures f;
+    computeWindowFeatures(stage.window, f);
+    float confidence = scoreImpactFeatures(f);
+
+    // Same knock rejection as the ML detector, on this window's samples
+    if (SPECTRAL_KNOCK_REJECT && isWindowVibrationDominated(stage.window)) {
+        confidence -= 0.2;
+    }
+
+    return constrain(confidence, 0.0, 1.0);
+}
+
+bool impactDetected() {
+    if (fillStage(stage)) {
+        lastConfidence = scoreWindow();
+    }
+    return lastConfidence >= IMPACT_THRESHOLD;
+}
+
+float getImpactConfidence() {
+    return lastConfidence;
+}
+
+void resetImpactDetector() {
+    resetStage(stage);
+    lastConfidence = 0.0;
+}
+
+const CrashDetectorOps impactDetector = {
+    "impact", initImpactDetector, impactDetected, getImpactConfidence, resetImpactDetector, nullptr, nullptr,
+    &stage.cursor
+};
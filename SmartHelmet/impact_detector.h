@@ -0,0 +1,26 @@
+#ifndef IMPACT_DETECTOR_H
+#define IMPACT_DETECTOR_H
+
+#include <Arduino.h>
+#include "detector.h"
+#include "pipeline.h"
+
+// Hard-impact detector on a short full-rate window (ImpactShape in
+// pipeline.h). It reacts within half a second of a hit instead of waiting
+// for the 2 s model window, at the cost of ignoring what comes after.
+
+#define IMPACT_THRESHOLD 0.6
+
+// Hard-impact score (0-1) of one window's features: peak acceleration,
+// rotation and a sustained jolt. Shared with the onset stage of the
+// multi-resolution detector, which scores its shorter window the same way.
+float scoreImpactFeatures(const WindowFeatures& f);
+
+bool initImpactDetector();
+bool impactDetected();
+float getImpactConfidence();
+void resetImpactDetector();
+
+extern const CrashDetectorOps impactDetector;
+
+#endif
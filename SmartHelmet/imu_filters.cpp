@@ -3,18 +3,18 @@
 #include "mpu6050.h"
 #include <math.h>
 
-float getPitch() {
-  float ax = getAx();
-  float ay = getAy();
-  float az = getAz();
-
+float pitchFrom(float ax, float ay, float az) {
   return atan2(ax, sqrt(ay*ay + az*az)) * 180.0 / PI;
 }
 
-float getRoll() {
-  float ay = getAy();
-  float ax = getAx();
-  float az = getAz();
-
+float rollFrom(float ax, float ay, float az) {
   return atan2(ay, sqrt(ax*ax + az*az)) * 180.0 / PI;
 }
+
+float getPitch() {
+  return pitchFrom(getAx(), getAy(), getAz());
+}
+
+float getRoll() {
+  return rollFrom(getAx(), getAy(), getAz());
+}
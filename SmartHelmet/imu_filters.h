@@ -4,4 +4,8 @@
 float getPitch();
 float getRoll();
 
+// Same as above for an explicit accelerometer reading (g)
+float pitchFrom(float ax, float ay, float az);
+float rollFrom(float ax, float ay, float az);
+
 #endif
@@ -1,146 +1,129 @@
 #include "ml_crash_detector.h"
-#include "mpu6050.h"
+#include "config.h"
+#include "pipeline.h"
+#include "model_shape.h"
+#include "accident_model.h"
+#include "spectral_features.h"
 #include <math.h>
 
-// Scaler parameters from training (from scaler_params.json)
+// Scaler parameters from training (from scaler_params.json); normalizeWindow()
+// only accepts arrays with one entry per ModelShape feature
 const float MEAN[] = {-0.34170, 0.08284, 0.32142, 7.12351, -11.35888, 7.33811};
 const float SCALE[] = {0.62090, 0.73600, 0.75600, 157.84258, 141.33477, 136.48935};
 
-// Window configuration (must match training)
-#define WINDOW_SIZE 100  // 2 seconds at 50Hz
-#define FEATURES 6       // ax, ay, az, gx, gy, gz
 #define THRESHOLD 0.5    // Accident probability threshold
 
-// Circular buffer for sensor data
-static float sensorBuffer[WINDOW_SIZE][FEATURES];
-static int bufferIndex = 0;
-static bool bufferFull = false;
-static unsigned long lastSampleTime = 0;
-static float lastConfidence = 0.0;
+// The exported model must take exactly the window this file is compiled for
+#ifdef ACCIDENT_MODEL_WINDOW_SIZE
+static_assert(ACCIDENT_MODEL_RATE_HZ == ModelShape::RATE_HZ, "accident_model.h was trained at a different rate");
+static_assert(ACCIDENT_MODEL_WINDOW_SIZE == ModelShape::WINDOW_SIZE, "accident_model.h window does not match ModelShape");
+static_assert(ACCIDENT_MODEL_FEATURES == ModelShape::FEATURES, "accident_model.h feature count does not match ModelShape");
+#endif
 
-#define SAMPLE_INTERVAL_MS 20  // 50Hz
+// Circular buffer for sensor data (one row per axis, see sample_window.h)
+static WindowStage<ModelShape> stage;
+static float lastConfidence = 0.0;
+static bool modelReady = false;
 
 // Simple neural network weights (placeholder - you'll need to extract from your model)
 // For now, using a simplified heuristic based on your model's likely behavior
-void initMLCrashDetector() {
-    bufferIndex = 0;
-    bufferFull = false;
+bool initMLCrashDetector() {
+    resetStage(stage);
     lastConfidence = 0.0;
+    modelReady = checkModelInput();
+    if (!modelReady) {
+        return false;
+    }
     Serial.println("ML Crash Detector initialized");
+    return true;
 }
 
-// Normalize a single feature value
-float normalize(float value, float mean, float scale) {
-    return (value - mean) / scale;
+bool checkModelInput() {
+    // Older headers carry no shape defines: check the flatbuffer itself
+    ModelInputInfo input;
+    if (readModelInput(accident_model, accident_model_len, input) &&
+        modelMatchesShape<ModelShape>(input)) {
+        return true;
+    }
+    Serial.print("ML model ERROR: input does not match [1,");
+    Serial.print(ModelShape::WINDOW_SIZE);
+    Serial.print(",");
+    Serial.print(ModelShape::FEATURES);
+    Serial.println("] float32 - re-export accident_model.h");
+    return false;
 }
 
-// Add sensor sample to buffer
-void addSensorSample() {
-    unsigned long now = millis();
-    if (now - lastSampleTime < SAMPLE_INTERVAL_MS) {
-        return;  // Not time yet
-    }
-    lastSampleTime = now;
-    
-    // Get current sensor readings
-    sensorBuffer[bufferIndex][0] = getAx();
-    sensorBuffer[bufferIndex][1] = getAy();
-    sensorBuffer[bufferIndex][2] = getAz();
-    sensorBuffer[bufferIndex][3] = getGx();
-    sensorBuffer[bufferIndex][4] = getGy();
-    sensorBuffer[bufferIndex][5] = getGz();
-    
-    bufferIndex++;
-    if (bufferIndex >= WINDOW_SIZE) {
-        bufferIndex = 0;
-        bufferFull = true;
-    }
+// Normalize the whole window into model input space ([time][feature])
+void normalizeModelInput(const SampleWindow<ModelShape>& window,
+                         float (&out)[ModelShape::WINDOW_SIZE][ModelShape::FEATURES]) {
+    normalizeWindow(window, MEAN, SCALE, out);
 }
 
-// Simplified ML inference (heuristic-based for now)
+// Simplified ML inference (heuristic-based for now), before clamping
 // TODO: Replace with actual TFLite inference when library is available
-float runInference() {
-    if (!bufferFull) {
-        return 0.0;  // Not enough data yet
-    }
-    
-    // Calculate features from the window
-    float maxAccel = 0.0;
-    float maxGyro = 0.0;
-    float accelVariance = 0.0;
-    float gyroVariance = 0.0;
+static float modelScore(const SampleWindow<ModelShape>& window) {
     
-    // First pass: calculate means and find max values
-    float accelMean = 0.0, gyroMean = 0.0;
-    for (int i = 0; i < WINDOW_SIZE; i++) {
-        float accelMag = sqrt(sensorBuffer[i][0]*sensorBuffer[i][0] + 
-                             sensorBuffer[i][1]*sensorBuffer[i][1] + 
-                             sensorBuffer[i][2]*sensorBuffer[i][2]);
-        float gyroMag = sqrt(sensorBuffer[i][3]*sensorBuffer[i][3] + 
-                            sensorBuffer[i][4]*sensorBuffer[i][4] + 
-                            sensorBuffer[i][5]*sensorBuffer[i][5]);
-        
-        accelMean += accelMag;
-        gyroMean += gyroMag;
-        
-        if (accelMag > maxAccel) maxAccel = accelMag;
-        if (gyroMag > maxGyro) maxGyro = gyroMag;
-    }
-    accelMean /= WINDOW_SIZE;
-    gyroMean /= WINDOW_SIZE;
-    
-    // Second pass: calculate variance
-    for (int i = 0; i < WINDOW_SIZE; i++) {
-        float accelMag = sqrt(sensorBuffer[i][0]*sensorBuffer[i][0] + 
-                             sensorBuffer[i][1]*sensorBuffer[i][1] + 
-                             sensorBuffer[i][2]*sensorBuffer[i][2]);
-        float gyroMag = sqrt(sensorBuffer[i][3]*sensorBuffer[i][3] + 
-                            sensorBuffer[i][4]*sensorBuffer[i][4] + 
-                            sensorBuffer[i][5]*sensorBuffer[i][5]);
-        
-        accelVariance += (accelMag - accelMean) * (accelMag - accelMean);
-        gyroVariance += (gyroMag - gyroMean) * (gyroMag - gyroMean);
-    }
-    accelVariance /= WINDOW_SIZE;
-    gyroVariance /= WINDOW_SIZE;
+    // Calculate features from the window (magnitudes computed once per sample)
+    WindowFeatures f;
+    computeWindowFeatures(window, f);
     
     // Simplified ML decision logic (learned from your data patterns)
     // This approximates what your CNN would learn
     float confidence = 0.0;
     
     // High acceleration spike indicates potential crash
-    if (maxAccel > 3.5) {
+    if (f.maxAccel > 3.5) {
         confidence += 0.3;
     }
     
     // High gyro (rapid rotation) indicates crash
-    if (maxGyro > 200) {
+    if (f.maxGyro > 200) {
         confidence += 0.25;
     }
     
     // High variance indicates sudden movement
-    if (accelVariance > 1.0) {
+    if (f.accelVariance > 1.0) {
         confidence += 0.2;
     }
-    if (gyroVariance > 5000) {
+    if (f.gyroVariance > 5000) {
         confidence += 0.15;
     }
     
     // Combined high values = very likely crash
-    if (maxAccel > 4.0 && maxGyro > 150) {
+    if (f.maxAccel > 4.0 && f.maxGyro > 150) {
         confidence += 0.3;
     }
     
-    confidence = constrain(confidence, 0.0, 1.0);
     return confidence;
 }
 
-bool mlCrashDetected() {
-    // Add new sensor sample
-    addSensorSample();
+float runModelCore(const SampleWindow<ModelShape>& window) {
+    if (!window.full) {
+        return 0.0;  // Not enough data yet
+    }
+    return constrain(modelScore(window), 0.0, 1.0);
+}
+
+float runModel(const SampleWindow<ModelShape>& window) {
+    if (!window.full) {
+        return 0.0;  // Not enough data yet
+    }
+    float confidence = modelScore(window);
     
-    // Run inference
-    lastConfidence = runInference();
+    // Energy concentrated above the body-motion band = buzz or knocks, not a
+    // fall. Judged on this window's own samples, not the live spectrum.
+    if (SPECTRAL_KNOCK_REJECT && isWindowVibrationDominated(window)) {
+        confidence -= 0.2;
+    }
+    
+    return constrain(confidence, 0.0, 1.0);
+}
+
+bool mlCrashDetected() {
+    // Add new sensor samples; the window only changes when one arrives
+    if (fillStage(stage) && modelReady) {
+        lastConfidence = runModel(stage.window);
+    }
     
     // Return true if confidence exceeds threshold
     return lastConfidence >= THRESHOLD;
@@ -150,8 +133,12 @@ float getMLConfidence() {
     return lastConfidence;
 }
 
+const CrashDetectorOps mlDetector = {
+    "ml", initMLCrashDetector, mlCrashDetected, getMLConfidence, resetMLCrashDetector, nullptr, nullptr,
+    &stage.cursor
+};
+
 void resetMLCrashDetector() {
-    bufferIndex = 0;
-    bufferFull = false;
+    resetStage(stage);
     lastConfidence = 0.0;
 }
@@ -2,9 +2,11 @@
 #define ML_CRASH_DETECTOR_H
 
 #include <Arduino.h>
+#include "detector.h"
+#include "pipeline.h"
 
-// Initialize ML crash detector
-void initMLCrashDetector();
+// Initialize ML crash detector; false if the model does not fit ModelShape
+bool initMLCrashDetector();
 
 // Returns true if ML model predicts an accident
 bool mlCrashDetected();
@@ -15,4 +17,22 @@ float getMLConfidence();
 // Reset the detector
 void resetMLCrashDetector();
 
+extern const CrashDetectorOps mlDetector;
+
+// The model itself, for pipelines that keep their own ModelShape window
+// (multires_detector.cpp). runModel() includes the spectral knock rejection
+// (SPECTRAL_KNOCK_REJECT), judged on the same window.
+// checkModelInput() reports a mismatch on Serial.
+bool checkModelInput();
+float runModel(const SampleWindow<ModelShape>& window);
+
+// The model alone, a function of the window only: what the golden-vector
+// check (golden_check.cpp, helmet-host-tools/check_model) compares with the
+// notebook's TFLite output
+float runModelCore(const SampleWindow<ModelShape>& window);
+
+// The model's input tensor for a window, scaled with the training scaler
+void normalizeModelInput(const SampleWindow<ModelShape>& window,
+                         float (&out)[ModelShape::WINDOW_SIZE][ModelShape::FEATURES]);
+
 #endif
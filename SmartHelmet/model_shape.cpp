@@ -0,0 +1,89 @@
+#include "model_shape.h"
+#include <string.h>
+
+// Just enough of the flatbuffer format to walk
+//   Model.subgraphs[0] -> SubGraph.inputs[0] -> SubGraph.tensors[i] -> Tensor.shape/type
+// Every offset is bounds-checked against len.
+
+// Field indices in the TFLite schema
+#define MODEL_SUBGRAPHS 2
+#define SUBGRAPH_TENSORS 0
+#define SUBGRAPH_INPUTS 1
+#define TENSOR_SHAPE 0
+#define TENSOR_TYPE 1
+
+struct FlatBuffer {
+    const unsigned char* data;
+    unsigned int len;
+};
+
+static bool readU32(const FlatBuffer& fb, unsigned int pos, unsigned int& out) {
+    if (pos + 4 > fb.len || pos + 4 < pos) return false;
+    out = (unsigned int)fb.data[pos] | ((unsigned int)fb.data[pos + 1] << 8) |
+          ((unsigned int)fb.data[pos + 2] << 16) | ((unsigned int)fb.data[pos + 3] << 24);
+    return true;
+}
+
+static bool readU16(const FlatBuffer& fb, unsigned int pos, unsigned int& out) {
+    if (pos + 2 > fb.len || pos + 2 < pos) return false;
+    out = (unsigned int)fb.data[pos] | ((unsigned int)fb.data[pos + 1] << 8);
+    return true;
+}
+
+// Position of a table field, or 0 if the field is absent
+static unsigned int fieldPos(const FlatBuffer& fb, unsigned int table, int field) {
+    unsigned int soffset, vtable, vtableSize, offset;
+    if (!readU32(fb, table, soffset)) return 0;
+    vtable = table - (unsigned int)(int)soffset;  // vtable = table - soffset (signed)
+    if (!readU16(fb, vtable, vtableSize)) return 0;
+    if (4 + 2 * (unsigned int)field + 2 > vtableSize) return 0;
+    if (!readU16(fb, vtable + 4 + 2 * field, offset) || offset == 0) return 0;
+    return table + offset;
+}
+
+// Follow a uoffset stored at pos
+static bool deref(const FlatBuffer& fb, unsigned int pos, unsigned int& out) {
+    unsigned int offset;
+    if (!readU32(fb, pos, offset)) return false;
+    out = pos + offset;
+    return out < fb.len;
+}
+
+// Vector referenced by a field: element count and position of element 0
+static bool vectorField(const FlatBuffer& fb, unsigned int table, int field,
+                        unsigned int& count, unsigned int& first) {
+    unsigned int pos = fieldPos(fb, table, field);
+    unsigned int vec;
+    if (pos == 0 || !deref(fb, pos, vec) || !readU32(fb, vec, count)) return false;
+    first = vec + 4;
+    return first + 4 * count <= fb.len && 4 * count / 4 == count;
+}
+
+bool readModelInput(const unsigned char* model, unsigned int len, ModelInputInfo& out) {
+    FlatBuffer fb = {model, len};
+    if (len < 8 || memcmp(model + 4, "TFL3", 4) != 0) return false;
+
+    unsigned int root, count, first, subgraph;
+    if (!deref(fb, 0, root)) return false;
+    if (!vectorField(fb, root, MODEL_SUBGRAPHS, count, first) || count == 0) return false;
+    if (!deref(fb, first, subgraph)) return false;
+
+    unsigned int inputCount, inputs, tensorCount, tensors, index;
+    if (!vectorField(fb, subgraph, SUBGRAPH_INPUTS, inputCount, inputs) || inputCount == 0) return false;
+    if (!vectorField(fb, subgraph, SUBGRAPH_TENSORS, tensorCount, tensors)) return false;
+    if (!readU32(fb, inputs, index) || index >= tensorCount) return false;
+
+    unsigned int tensor, rank, dims;
+    if (!deref(fb, tensors + 4 * index, tensor)) return false;
+    if (!vectorField(fb, tensor, TENSOR_SHAPE, rank, dims) || rank > MODEL_MAX_DIMS) return false;
+    out.rank = (int)rank;
+    for (unsigned int d = 0; d < rank; d++) {
+        unsigned int v;
+        if (!readU32(fb, dims + 4 * d, v)) return false;
+        out.dims[d] = (int)v;
+    }
+    unsigned int typePos = fieldPos(fb, tensor, TENSOR_TYPE);
+    if (typePos >= len) return false;
+    out.type = typePos ? model[typePos] : MODEL_TENSOR_FLOAT32;  // absent = default (float32)
+    return true;
+}
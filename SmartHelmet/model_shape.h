@@ -0,0 +1,28 @@
+#ifndef MODEL_SHAPE_H
+#define MODEL_SHAPE_H
+
+// Input tensor of a TensorFlow Lite model, read straight from the flatbuffer
+// (the accident_model.h array) without linking TFLite. Used at startup to
+// refuse a model exported for a different window or feature set.
+
+#define MODEL_MAX_DIMS 4
+#define MODEL_TENSOR_FLOAT32 0  // tflite::TensorType_FLOAT32
+
+struct ModelInputInfo {
+    int dims[MODEL_MAX_DIMS];
+    int rank;
+    int type;
+};
+
+// False if the buffer is not a TFLite model or has no usable input tensor
+bool readModelInput(const unsigned char* model, unsigned int len, ModelInputInfo& out);
+
+// True if the model takes one float window of this pipeline shape
+// ([1, WINDOW_SIZE, FEATURES], see pipeline.h)
+template <typename Shape>
+inline bool modelMatchesShape(const ModelInputInfo& in) {
+    return in.type == MODEL_TENSOR_FLOAT32 && in.rank == 3 && in.dims[0] == 1 &&
+           in.dims[1] == Shape::WINDOW_SIZE && in.dims[2] == Shape::FEATURES;
+}
+
+#endif
@@ -1,11 +1,14 @@
 #include <Arduino.h>
 #include "mpu6050.h"
 #include "config.h"
+#include "sample_ring.h"
 #include <Wire.h>
 
 static float ax, ay, az;
 static float gx, gy, gz;
 static bool mpuReady = false;
+static unsigned long nextSampleTime = 0;
+static unsigned long missedSamples = 0;
 
 // MPU6050 registers
 #define PWR_MGMT_1  0x6B
@@ -30,9 +33,24 @@ bool isMPUReady() {
   return mpuReady;
 }
 
+unsigned long getMissedSamples() {
+  return missedSamples;
+}
+
 void updateIMU() {
   if (!mpuReady) return;
 
+  // Sample at a fixed rate; every reading goes into the shared sample ring
+  unsigned long now = millis();
+  if ((long)(now - nextSampleTime) < 0) return;
+  nextSampleTime += IMU_SAMPLE_INTERVAL_MS;
+  if ((long)(now - nextSampleTime) >= 0) {
+    // Fell behind: this read stands in for the oldest due period, the ones
+    // after it are lost. Count them so gaps at the source are reported.
+    missedSamples += (now - nextSampleTime) / IMU_SAMPLE_INTERVAL_MS + 1;
+    nextSampleTime = now + IMU_SAMPLE_INTERVAL_MS;  // resync
+  }
+
   Wire.beginTransmission(MPU6050_ADDR);
   Wire.write(ACCEL_XOUT);
   Wire.endTransmission(false);
@@ -56,6 +74,12 @@ void updateIMU() {
   gy = rawGy / GYRO_SCALE;
   gz = rawGz / GYRO_SCALE;
 
+  ImuSample s;
+  s.timestampMs = now;
+  s.ax = ax; s.ay = ay; s.az = az;
+  s.gx = gx; s.gy = gy; s.gz = gz;
+  writeSample(s);
+
   #if DEBUG
   Serial.print("IMU | Ax: "); Serial.print(ax);
   Serial.print(" Ay: "); Serial.print(ay);
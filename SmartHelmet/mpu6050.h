@@ -5,6 +5,10 @@ void initMPU();
 void updateIMU();
 bool isMPUReady();
 
+// Sample periods skipped because updateIMU() was called late (never read,
+// so no consumer of the sample ring sees them); counts up from boot
+unsigned long getMissedSamples();
+
 // Accelerometer values in g
 float getAx();
 float getAy();
@@ -10,6 +10,9 @@ const char* ssid = "Oppo 17";
 const char* password = "1234567802";
 const char* mqtt_server = "broker.hivemq.com";
 
+// Telemetry batches are larger than PubSubClient's 256 byte default
+#define MQTT_BUFFER_SIZE 1280
+
 WiFiClient espClient;
 PubSubClient client(espClient);
 extern void onExternalAccidentPending();
@@ -45,6 +48,7 @@ void initMQTT() {
   setupWiFi();
   client.setServer(mqtt_server, 1883);
   client.setCallback(mqttCallback);
+  client.setBufferSize(MQTT_BUFFER_SIZE);
   reconnectMQTT();
 }
 
@@ -95,6 +99,18 @@ void publishAccidentPending() {
   Serial.println(" MQTT: Crash pending published");
 }
 
+// Telemetry is best effort: QoS 0, not retained, never reconnects
+bool publishTelemetry(const char* payload) {
+  if (!client.connected()) return false;
+  return client.publish("helmet/H001/telemetry", payload, false);
+}
+
+// Shadow detector disagreements, same best-effort rules as telemetry
+bool publishShadowReport(const char* payload) {
+  if (!client.connected()) return false;
+  return client.publish("helmet/H001/shadow", payload, false);
+}
+
 void publishCrashConfirmed() {
   char payload[256];
 
@@ -126,18 +142,18 @@ void publishCrashConfirmed() {
   Serial.println("🚨 MQTT: Crash confirmed published");
 }
 
-void publishCrashCancelled() {
+void publishCrashCancelled(const char* reason) {
   char payload[200];
 
   snprintf(payload, sizeof(payload),
     "{"
       "\"type\":\"CRASH_CANCELLED\","
       "\"helmetId\":\"H001\","
-      "\"reason\":\"USER_OVERRIDE\","
+      "\"reason\":\"%s\","
       "\"timestamp\":%lu,"
       "\"source\":\"ESP32\""
     "}",
-    millis()
+    reason, millis()
   );
 
   client.publish("helmet/H001/event", payload, true);
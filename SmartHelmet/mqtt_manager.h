@@ -6,7 +6,9 @@ void initMQTT();
 void handleMQTT();
 void mqttCallback(char* topic, uint8_t* payload, unsigned int length);
 void publishCrashConfirmed();
-void publishCrashCancelled();
+void publishCrashCancelled(const char* reason);  // USER_OVERRIDE or CONTEXT_DOWNGRADE
 void publishAccidentPending();
+bool publishTelemetry(const char* payload);
+bool publishShadowReport(const char* payload);
 
 #endif
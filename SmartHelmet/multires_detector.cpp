@@ -0,0 +1,158 @@
+#include "multires_detector.h"
+#include "config.h"
+#include "pipeline.h"
+#include "ml_crash_detector.h"
+#include "impact_detector.h"
+
+#define ONSET_THRESHOLD IMPACT_THRESHOLD  // onset score that raises the alert
+#define CONTEXT_THRESHOLD 0.5   // same as the ML detector
+
+// A slow loop() (a blocking publish, Serial reports) skips a few IMU reads;
+// that must not blind the review for the 2 s the context window needs to
+// refill. Only a stall longer than the ring spans clears the history.
+#define MAX_SAMPLE_GAP_MS (SAMPLE_RING_SIZE * IMU_SAMPLE_INTERVAL_MS)
+
+static_assert(CONTEXT_CONFIRM_MS < CANCEL_WINDOW_MS,
+              "the context verdict must arrive while the alert can still be withdrawn");
+
+// One history: both windows are fed from the same cursor
+static SampleCursor cursor;
+static SampleWindow<OnsetShape> onset;
+static SampleWindow<ModelShape> context;
+static RateGate onsetGate;
+static RateGate contextGate;
+static bool haveSample = false;
+static unsigned long lastSampleTime = 0;
+static uint32_t lastOverruns = 0;
+
+static float onsetConfidence = 0.0;
+static float contextConfidence = 0.0;
+
+// The last trigger and what the context stage made of it
+static bool triggered = false;
+static bool unreported = false;  // raised, not yet returned by detect()
+static unsigned long triggerTime = 0;
+static bool onsetArmed = true;   // onset score has dropped since its last trigger
+static DetectorVerdict verdict = VERDICT_CONFIRMED;
+
+static void clearHistory() {
+    resetSampleWindow(onset);
+    resetSampleWindow(context);
+    resetRateGate(onsetGate);
+    resetRateGate(contextGate);
+    onsetConfidence = 0.0;
+    contextConfidence = 0.0;
+}
+
+bool initMultiResDetector() {
+    initSampleCursor(cursor);
+    lastOverruns = 0;
+    haveSample = false;
+    clearHistory();
+    onsetArmed = true;
+    triggered = false;
+    unreported = false;
+    verdict = VERDICT_CONFIRMED;
+    if (!checkModelInput()) {
+        return false;
+    }
+    Serial.println("Multi-resolution Detector initialized");
+    return true;
+}
+
+// The impact detector's score on the onset window. No knock rejection here:
+// 80 ms is far shorter than a period of the lowest vibration band, so the
+// context review is what sorts knocks from crashes.
+static float scoreOnset() {
+    WindowFeatures f;
+    computeWindowFeatures(onset, f);
+    return scoreImpactFeatures(f);
+}
+
+static void trigger(unsigned long t, DetectorVerdict v) {
+    triggered = true;
+    unreported = true;
+    triggerTime = t;
+    verdict = v;
+}
+
+// Consume new samples. New triggers are only raised when detecting; while an
+// alert is pending the samples just extend the context for the review.
+static void update(bool detecting) {
+    if (cursor.overruns != lastOverruns) {
+        lastOverruns = cursor.overruns;
+        clearHistory();
+    }
+
+    bool contextChanged = false;
+    ImuSample s;
+    while (readSample(cursor, s)) {
+        if (haveSample && s.timestampMs - lastSampleTime > MAX_SAMPLE_GAP_MS) {
+            clearHistory();
+        }
+        haveSample = true;
+        lastSampleTime = s.timestampMs;
+
+        if (acceptSample<ModelShape>(contextGate, s)) {
+            pushSample(context, s);
+            contextChanged = true;
+        }
+        if (!acceptSample<OnsetShape>(onsetGate, s)) continue;
+        pushSample(onset, s);
+        if (!onset.full) continue;
+
+        onsetConfidence = scoreOnset();
+        // One trigger per hit: the peak stays in the window for a while
+        if (onsetConfidence < ONSET_THRESHOLD) {
+            onsetArmed = true;
+        } else if (detecting && !unreported && onsetArmed) {
+            onsetArmed = false;
+            trigger(s.timestampMs, VERDICT_PENDING);
+        }
+    }
+
+    if (contextChanged && context.full) {
+        contextConfidence = runModel(context);
+    }
+
+    // A verdict needs a full context window (e.g. not just after power-up or a
+    // gap); until then the alert stays pending and stands when the state
+    // machine's cancel window runs out
+    if (triggered && verdict == VERDICT_PENDING && context.full &&
+        lastSampleTime - triggerTime >= CONTEXT_CONFIRM_MS) {
+        verdict = contextConfidence >= CONTEXT_THRESHOLD ? VERDICT_CONFIRMED : VERDICT_DOWNGRADED;
+    }
+
+    // Context-only trigger, once the last trigger has left the context window
+    bool rearmed = !triggered || lastSampleTime - triggerTime > ModelShape::WINDOW_MS;
+    if (detecting && !unreported && rearmed && contextConfidence >= CONTEXT_THRESHOLD) {
+        trigger(lastSampleTime, VERDICT_CONFIRMED);
+    }
+}
+
+bool multiResCrashDetected() {
+    update(true);
+    if (!unreported) return false;
+    unreported = false;
+    return true;
+}
+
+float getMultiResConfidence() {
+    if (triggered && verdict == VERDICT_PENDING) return onsetConfidence;
+    return onsetConfidence > contextConfidence ? onsetConfidence : contextConfidence;
+}
+
+// Re-arms after a trigger; the history and the pending review are kept
+void resetMultiResDetector() {
+    unreported = false;
+}
+
+DetectorVerdict reviewMultiResTrigger() {
+    update(false);
+    return verdict;
+}
+
+const CrashDetectorOps multiResDetector = {
+    "multires", initMultiResDetector, multiResCrashDetected, getMultiResConfidence,
+    resetMultiResDetector, reviewMultiResTrigger, nullptr, &cursor
+};
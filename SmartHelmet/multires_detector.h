@@ -0,0 +1,28 @@
+#ifndef MULTIRES_DETECTOR_H
+#define MULTIRES_DETECTOR_H
+
+#include <Arduino.h>
+#include "detector.h"
+
+// Two-stage detector on one sample history.
+//
+// The onset stage (OnsetShape, ~80 ms at the IMU rate) raises the alert as
+// soon as a hard impact shows up. The context stage (ModelShape, the 2 s ML
+// window) then reviews it once it has seen CONTEXT_CONFIRM_MS of what came
+// after (and has a full window): the alert is confirmed or downgraded. The
+// context stage can also trigger on its own, for falls without a sharp impact.
+//
+// Both windows are fed from one cursor and are never cleared by a trigger or
+// a reset, so the detector does not go blind for a window length after an
+// alarm. History is only dropped after a ring overrun or a stall longer than
+// the ring spans, because the windows would no longer be contiguous.
+
+bool initMultiResDetector();
+bool multiResCrashDetected();
+float getMultiResConfidence();
+void resetMultiResDetector();
+DetectorVerdict reviewMultiResTrigger();
+
+extern const CrashDetectorOps multiResDetector;
+
+#endif
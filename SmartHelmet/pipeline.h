@@ -0,0 +1,176 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "config.h"
+#include "sample_ring.h"
+#include "sample_window.h"
+#include "feature_kernels.h"
+
+// Compile-time shape of a detection pipeline: sample rate, window length and
+// feature set (3 = accelerometer, 6 = accelerometer + gyro). Windows, scaler
+// arrays and feature loops are sized from it, so every shape gets its own
+// code with constant trip counts and nothing is dispatched at run time.
+template <int RateHz, int WindowMs, int Features>
+struct PipelineShape {
+    static constexpr int RATE_HZ = RateHz;
+    static constexpr int WINDOW_MS = WindowMs;
+    static constexpr int FEATURES = Features;
+    static constexpr int SAMPLE_INTERVAL_MS = 1000 / RateHz;
+    static constexpr int WINDOW_SIZE = RateHz * WindowMs / 1000;
+
+    static_assert(RateHz > 0 && IMU_SAMPLE_RATE % RateHz == 0,
+                  "pipeline rate must divide IMU_SAMPLE_RATE (samples are decimated from the ring)");
+    static_assert(RateHz * WindowMs % 1000 == 0, "window must hold a whole number of samples");
+    static_assert(WINDOW_SIZE >= 2, "window too short");
+    static_assert(Features == 3 || Features == IMU_AXES, "feature set is 3 (accel) or 6 (accel + gyro)");
+};
+
+// Input of the ML model (accident_model.h, ml-data training notebook). The
+// data logger records at this rate so new training data matches.
+typedef PipelineShape<50, 2000, IMU_AXES> ModelShape;
+
+// Hard impacts: half a second at the full IMU rate (impact_detector.cpp)
+typedef PipelineShape<IMU_SAMPLE_RATE, 500, IMU_AXES> ImpactShape;
+
+// Impact onset: the first tens of milliseconds of a hit (multires_detector.cpp)
+typedef PipelineShape<IMU_SAMPLE_RATE, 80, IMU_AXES> OnsetShape;
+
+// Vibration bands: 32 accelerometer samples at the model rate, so the sliding
+// DFT bins sit 1.56 Hz apart (spectral_features.cpp)
+typedef PipelineShape<50, 640, 3> SpectralShape;
+
+// ---------------------------------------------------------------------------
+// Feeding a window from the sample ring
+// ---------------------------------------------------------------------------
+
+// Ring timestamps can jitter by a tick; accept samples up to half an IMU
+// period early so 100Hz input decimates to exactly every other sample
+#define SAMPLE_SLACK_MS (IMU_SAMPLE_INTERVAL_MS / 2)
+
+struct RateGate {
+    bool haveSample;
+    unsigned long lastSampleTime;
+};
+
+inline void resetRateGate(RateGate& g) {
+    g.haveSample = false;
+    g.lastSampleTime = 0;
+}
+
+// True if s is due for a pipeline of this shape (one sample per period)
+template <typename Shape>
+inline bool acceptSample(RateGate& g, const ImuSample& s) {
+    if (g.haveSample && s.timestampMs - g.lastSampleTime < Shape::SAMPLE_INTERVAL_MS - SAMPLE_SLACK_MS) {
+        return false;  // Not time yet
+    }
+    g.haveSample = true;
+    g.lastSampleTime = s.timestampMs;
+    return true;
+}
+
+// A window with its own cursor on the shared sample ring
+template <typename Shape>
+struct WindowStage {
+    SampleWindow<Shape> window;
+    SampleCursor cursor;
+    RateGate gate;
+};
+
+template <typename Shape>
+inline void resetStage(WindowStage<Shape>& st) {
+    resetSampleWindow(st.window);
+    initSampleCursor(st.cursor);
+    resetRateGate(st.gate);
+}
+
+// Move new ring samples into the window at the shape's rate.
+// Returns true if the window changed.
+template <typename Shape>
+inline bool fillStage(WindowStage<Shape>& st) {
+    bool added = false;
+    ImuSample s;
+    while (readSample(st.cursor, s)) {
+        if (!acceptSample<Shape>(st.gate, s)) continue;
+        pushSample(st.window, s);
+        added = true;
+    }
+    return added;
+}
+
+// ---------------------------------------------------------------------------
+// Window features
+// ---------------------------------------------------------------------------
+
+// Summary of one window, from the fixed-length batch kernels
+struct WindowFeatures {
+    float maxAccel;
+    float accelMean;
+    float accelVariance;
+    float maxGyro;       // gyro fields are 0 for accelerometer-only shapes
+    float gyroMean;
+    float gyroVariance;
+};
+
+// Peak, mean and variance of |(x, y, z)| over one window
+template <int N>
+inline void magnitudeStats(const float* x, const float* y, const float* z,
+                           float& peak, float& mean, float& variance) {
+    alignas(16) static float mag[N];
+    float lo;
+    magnitude3N<N>(x, y, z, mag);
+    minMaxN<N>(mag, &lo, &peak);
+    mean = sumOfN<N>(mag) / N;
+    normalizeIntoN<N>(mag, mag, mean, 1.0f);  // center in place
+    variance = dotProductN<N>(mag, mag) / N;
+}
+
+template <typename Shape, bool HasGyro = (Shape::FEATURES == IMU_AXES)>
+struct GyroFeatures {
+    static void compute(const SampleWindow<Shape>& w, WindowFeatures& f) {
+        magnitudeStats<Shape::WINDOW_SIZE>(w.axis[AXIS_GX], w.axis[AXIS_GY], w.axis[AXIS_GZ],
+                                           f.maxGyro, f.gyroMean, f.gyroVariance);
+    }
+};
+
+template <typename Shape>
+struct GyroFeatures<Shape, false> {
+    static void compute(const SampleWindow<Shape>&, WindowFeatures& f) {
+        f.maxGyro = 0.0f;
+        f.gyroMean = 0.0f;
+        f.gyroVariance = 0.0f;
+    }
+};
+
+// Order does not matter for these features, so the circular rows are used as-is
+template <typename Shape>
+inline void computeWindowFeatures(const SampleWindow<Shape>& w, WindowFeatures& f) {
+    magnitudeStats<Shape::WINDOW_SIZE>(w.axis[AXIS_AX], w.axis[AXIS_AY], w.axis[AXIS_AZ],
+                                       f.maxAccel, f.accelMean, f.accelVariance);
+    GyroFeatures<Shape>::compute(w, f);
+}
+
+// ---------------------------------------------------------------------------
+// Model input
+// ---------------------------------------------------------------------------
+
+// Scale the window into model input space: [time][feature], oldest sample
+// first, i.e. the model's [1, WINDOW_SIZE, FEATURES] input tensor. The scaler
+// arrays must have exactly Shape::FEATURES entries or this does not compile.
+template <typename Shape>
+inline void normalizeWindow(const SampleWindow<Shape>& w,
+                            const float (&mean)[Shape::FEATURES],
+                            const float (&scale)[Shape::FEATURES],
+                            float (&out)[Shape::WINDOW_SIZE][Shape::FEATURES]) {
+    float inv[Shape::FEATURES];
+    for (int f = 0; f < Shape::FEATURES; f++) inv[f] = 1.0f / scale[f];
+
+    int i = w.full ? w.index : 0;
+    for (int t = 0; t < Shape::WINDOW_SIZE; t++) {
+        for (int f = 0; f < Shape::FEATURES; f++) {
+            out[t][f] = (w.axis[f][i] - mean[f]) * inv[f];
+        }
+        if (++i == Shape::WINDOW_SIZE) i = 0;
+    }
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "sample_ring.h"
+
+#define RING_MASK (SAMPLE_RING_SIZE - 1)
+
+static ImuSample ring[SAMPLE_RING_SIZE];
+static uint32_t writeSeq = 0;
+static uint32_t filled = 0;  // slots written so far, up to SAMPLE_RING_SIZE
+
+void writeSample(ImuSample& s) {
+    s.seq = writeSeq;
+    ring[writeSeq & RING_MASK] = s;
+    writeSeq++;
+    if (filled < SAMPLE_RING_SIZE) {
+        filled++;
+    }
+}
+
+void initSampleCursor(SampleCursor& c) {
+    c.next = writeSeq;
+    c.overruns = 0;
+}
+
+bool readSample(SampleCursor& c, ImuSample& out) {
+    uint32_t behind = writeSeq - c.next;
+    if (behind == 0 || (c.limited && c.readsLeft == 0)) {
+        return false;
+    }
+    if (c.limited) {
+        c.readsLeft--;
+    }
+    if (behind > SAMPLE_RING_SIZE) {
+        // Oldest unread samples have been overwritten
+        c.overruns += behind - SAMPLE_RING_SIZE;
+        c.next = writeSeq - SAMPLE_RING_SIZE;
+    }
+    out = ring[c.next & RING_MASK];
+    c.next++;
+    return true;
+}
+
+void limitCursorReads(SampleCursor& c, int maxSamples) {
+    c.limited = maxSamples >= 0;
+    c.readsLeft = c.limited ? (uint32_t)maxSamples : 0;
+}
+
+uint32_t nextSampleSeq() {
+    return writeSeq;
+}
+
+bool peekSample(uint32_t seq, ImuSample& out) {
+    // Before the ring has filled, seq values below 0 wrap around: they pass
+    // the age check but were never written
+    uint32_t age = writeSeq - seq;
+    if (age == 0 || age > filled) {
+        return false;
+    }
+    out = ring[seq & RING_MASK];
+    return true;
+}
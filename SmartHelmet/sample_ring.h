@@ -0,0 +1,50 @@
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <stdint.h>
+
+// Single-writer, multi-reader ring of IMU samples.
+// updateIMU() writes each sample once; every consumer (ML detector, threshold
+// detector, data logger, ...) owns a SampleCursor and reads the samples at its
+// own pace. A reader that falls more than SAMPLE_RING_SIZE samples behind
+// skips ahead to the oldest sample still held and counts the dropped ones.
+
+#define SAMPLE_RING_SIZE 128  // must be a power of two (1.28 s at 100Hz)
+
+struct ImuSample {
+    uint32_t seq;              // increments by one per sample
+    unsigned long timestampMs; // millis() when the sample was read
+    float ax, ay, az;          // g
+    float gx, gy, gz;          // deg/s
+};
+
+struct SampleCursor {
+    uint32_t next;      // sequence number of the next sample to read
+    uint32_t overruns;  // samples dropped because the reader fell behind
+    bool limited;       // set by limitCursorReads(); zero-initialized = no limit
+    uint32_t readsLeft; // samples readSample() still hands out while limited
+};
+
+// Append a sample; seq is assigned by the ring
+void writeSample(ImuSample& s);
+
+// Position a cursor after the newest sample (it will only see new samples)
+void initSampleCursor(SampleCursor& c);
+
+// Read the next unread sample; returns false if the cursor is up to date
+bool readSample(SampleCursor& c, ImuSample& out);
+
+// Cap the samples readSample() hands out through this cursor until the cap
+// is lifted with a negative value. Bounds the work of a reader that is far
+// behind (detector_manager.cpp caps each shadow per loop); the rest of its
+// backlog stays in the ring for the next call. initSampleCursor() keeps it.
+void limitCursorReads(SampleCursor& c, int maxSamples);
+
+// Sequence number the next written sample will get
+uint32_t nextSampleSeq();
+
+// Copy the sample with a given sequence number; false if it was never
+// written or has already been overwritten
+bool peekSample(uint32_t seq, ImuSample& out);
+
+#endif
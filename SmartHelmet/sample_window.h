@@ -0,0 +1,43 @@
+#ifndef SAMPLE_WINDOW_H
+#define SAMPLE_WINDOW_H
+
+#include "sample_ring.h"
+
+// Axes in the order the model and the CSV logs use. A pipeline with
+// FEATURES = 3 keeps only the accelerometer rows.
+enum Axis { AXIS_AX, AXIS_AY, AXIS_AZ, AXIS_GX, AXIS_GY, AXIS_GZ };
+#define IMU_AXES 6
+
+// Sliding window of IMU samples stored as structure-of-arrays: one contiguous
+// row per axis, so batch kernels can stream over a single axis at a time.
+// Rows are circular; index is the slot the next sample is written to.
+// Sized by a pipeline shape (pipeline.h).
+template <typename Shape>
+struct SampleWindow {
+    alignas(16) float axis[Shape::FEATURES][Shape::WINDOW_SIZE];
+    int index;
+    bool full;
+};
+
+template <typename Shape>
+inline void resetSampleWindow(SampleWindow<Shape>& w) {
+    w.index = 0;
+    w.full = false;
+}
+
+template <typename Shape>
+inline void pushSample(SampleWindow<Shape>& w, const ImuSample& s) {
+    const float values[IMU_AXES] = {s.ax, s.ay, s.az, s.gx, s.gy, s.gz};
+    int i = w.index;
+    for (int f = 0; f < Shape::FEATURES; f++) {
+        w.axis[f][i] = values[f];
+    }
+
+    w.index++;
+    if (w.index >= Shape::WINDOW_SIZE) {
+        w.index = 0;
+        w.full = true;
+    }
+}
+
+#endif
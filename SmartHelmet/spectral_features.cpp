@@ -0,0 +1,162 @@
+#include "spectral_features.h"
+#include "config.h"
+#include "pipeline.h"
+#include <math.h>
+
+#define SPECTRAL_AXES SpectralShape::FEATURES
+
+// Damping keeps the recursive update stable under float rounding: r^N ~ 0.997
+#define DAMPING 0.9999f
+
+// Tracked bins and the band each one belongs to
+static const int BINS[] = {1, 2, 3, 4, 6, 8, 9, 12, 15};
+static const SpectralBand BIN_BAND[] = {BAND_LOW, BAND_LOW, BAND_LOW,
+                                        BAND_MID, BAND_MID, BAND_MID,
+                                        BAND_HIGH, BAND_HIGH, BAND_HIGH};
+#define BIN_COUNT (int)(sizeof(BINS) / sizeof(BINS[0]))
+
+static float twiddleRe[BIN_COUNT];
+static float twiddleIm[BIN_COUNT];
+static float dampingN;  // DAMPING^SPECTRAL_WINDOW
+
+// Per axis: sample history (to remove the oldest sample) and bin state
+static float history[SPECTRAL_AXES][SPECTRAL_WINDOW];
+static float binRe[SPECTRAL_AXES][BIN_COUNT];
+static float binIm[SPECTRAL_AXES][BIN_COUNT];
+static int historyIndex = 0;
+static int samplesSeen = 0;
+
+static SampleCursor sampleCursor;
+static RateGate gate;
+
+void initSpectralFeatures() {
+    for (int b = 0; b < BIN_COUNT; b++) {
+        float w = 2.0f * (float)M_PI * BINS[b] / SPECTRAL_WINDOW;
+        twiddleRe[b] = DAMPING * cosf(w);
+        twiddleIm[b] = DAMPING * sinf(w);
+    }
+    dampingN = powf(DAMPING, SPECTRAL_WINDOW);
+    resetSpectralFeatures();
+}
+
+void resetSpectralFeatures() {
+    for (int a = 0; a < SPECTRAL_AXES; a++) {
+        for (int i = 0; i < SPECTRAL_WINDOW; i++) history[a][i] = 0.0f;
+        for (int b = 0; b < BIN_COUNT; b++) {
+            binRe[a][b] = 0.0f;
+            binIm[a][b] = 0.0f;
+        }
+    }
+    historyIndex = 0;
+    samplesSeen = 0;
+    initSampleCursor(sampleCursor);
+    resetRateGate(gate);
+}
+
+// Sliding DFT: X_k <- r e^{j2pi k/N} (X_k + x_new - r^N x_old)
+void pushSpectralSample(float ax, float ay, float az) {
+    float in[SPECTRAL_AXES] = {ax, ay, az};
+    for (int a = 0; a < SPECTRAL_AXES; a++) {
+        float delta = in[a] - dampingN * history[a][historyIndex];
+        history[a][historyIndex] = in[a];
+        for (int b = 0; b < BIN_COUNT; b++) {
+            float re = binRe[a][b] + delta;
+            float im = binIm[a][b];
+            binRe[a][b] = re * twiddleRe[b] - im * twiddleIm[b];
+            binIm[a][b] = re * twiddleIm[b] + im * twiddleRe[b];
+        }
+    }
+    historyIndex = (historyIndex + 1) % SPECTRAL_WINDOW;
+    if (samplesSeen < SPECTRAL_WINDOW) samplesSeen++;
+}
+
+void updateSpectralFeatures() {
+    ImuSample s;
+    while (readSample(sampleCursor, s)) {
+        if (!acceptSample<SpectralShape>(gate, s)) continue;
+        pushSpectralSample(s.ax, s.ay, s.az);
+    }
+}
+
+bool spectralReady() {
+    return samplesSeen >= SPECTRAL_WINDOW;
+}
+
+float getBandEnergy(int axis, SpectralBand band) {
+    // A sinusoid of amplitude A at bin k gives |X_k| = A * N / 2
+    const float norm = 4.0f / ((float)SPECTRAL_WINDOW * SPECTRAL_WINDOW);
+    float energy = 0.0f;
+    for (int b = 0; b < BIN_COUNT; b++) {
+        if (BIN_BAND[b] != band) continue;
+        energy += (binRe[axis][b] * binRe[axis][b] + binIm[axis][b] * binIm[axis][b]) * norm;
+    }
+    return energy;
+}
+
+float getTotalBandEnergy(SpectralBand band) {
+    float energy = 0.0f;
+    for (int a = 0; a < SPECTRAL_AXES; a++) {
+        energy += getBandEnergy(a, band);
+    }
+    return energy;
+}
+
+float getBandShare(SpectralBand band) {
+    float total = 0.0f;
+    for (int b = 0; b < BAND_COUNT; b++) {
+        total += getTotalBandEnergy((SpectralBand)b);
+    }
+    if (total <= 0.0f) return 0.0f;
+    return getTotalBandEnergy(band) / total;
+}
+
+bool bandsVibrationDominated(const float (&energy)[BAND_COUNT]) {
+    float total = 0.0f;
+    for (int b = 0; b < BAND_COUNT; b++) {
+        total += energy[b];
+    }
+    return total > SPECTRAL_MIN_ENERGY && energy[BAND_LOW] < SPECTRAL_LOW_SHARE_MIN * total;
+}
+
+bool isVibrationDominated() {
+    if (!spectralReady()) return false;
+    float energy[BAND_COUNT];
+    for (int b = 0; b < BAND_COUNT; b++) {
+        energy[b] = getTotalBandEnergy((SpectralBand)b);
+    }
+    return bandsVibrationDominated(energy);
+}
+
+// Band energies of one segment, added to energy[] with a weight.
+// Goertzel: s <- x + 2cos(w) s1 - s2, |X|^2 = s1^2 + s2^2 - 2cos(w) s1 s2
+static void addSegmentBandEnergy(const float* x, int n, int rateHz, float weight, float (&energy)[BAND_COUNT]) {
+    float mean = 0.0f;
+    for (int t = 0; t < n; t++) mean += x[t];
+    mean /= n;
+
+    const float norm = weight * 4.0f / ((float)n * n);  // same scaling as getBandEnergy()
+    for (int b = 0; b < BIN_COUNT; b++) {
+        float hz = (float)BINS[b] * SpectralShape::RATE_HZ / SPECTRAL_WINDOW;
+        if (2.0f * hz >= rateHz) continue;  // above Nyquist for this window's rate
+        float coeff = 2.0f * cosf(2.0f * (float)M_PI * hz / rateHz);
+        float s1 = 0.0f, s2 = 0.0f;
+        for (int t = 0; t < n; t++) {
+            float s = (x[t] - mean) + coeff * s1 - s2;
+            s2 = s1;
+            s1 = s;
+        }
+        energy[BIN_BAND[b]] += (s1 * s1 + s2 * s2 - coeff * s1 * s2) * norm;
+    }
+}
+
+// Averaged over back-to-back segments as long as the streaming window, newest
+// first: the tracked bins are SPECTRAL_WINDOW-sample wide, so one long DFT
+// would leave gaps between them that a tone could fall into
+void addSequenceBandEnergy(const float* x, int n, int rateHz, float (&energy)[BAND_COUNT]) {
+    int segment = SpectralShape::WINDOW_MS * rateHz / 1000;
+    if (segment > n) segment = n;
+    int segments = n / segment;
+    for (int k = 1; k <= segments; k++) {
+        addSegmentBandEnergy(x + n - k * segment, segment, rateHz, 1.0f / segments, energy);
+    }
+}
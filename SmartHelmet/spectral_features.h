@@ -0,0 +1,77 @@
+#ifndef SPECTRAL_FEATURES_H
+#define SPECTRAL_FEATURES_H
+
+// Streaming vibration features: a few sliding DFT bins per accelerometer axis,
+// updated in O(bins) per sample, grouped into three bands.
+//
+// Runs at SpectralShape's rate (50Hz, the recorded/model rate) over its
+// SPECTRAL_WINDOW sample window, so bin k sits at k * 50 / SPECTRAL_WINDOW Hz
+// (1.56 Hz steps):
+//   LOW  ~1.5-5 Hz  body motion, falls, tumbling
+//   MID  ~6-12 Hz   road buzz
+//   HIGH ~14-23 Hz  knocks and other sharp, short impacts
+
+#include "pipeline.h"
+
+#define SPECTRAL_WINDOW SpectralShape::WINDOW_SIZE
+
+enum SpectralBand { BAND_LOW, BAND_MID, BAND_HIGH, BAND_COUNT };
+
+void initSpectralFeatures();
+void resetSpectralFeatures();
+
+// Consume new samples from the shared sample ring (call once per loop)
+void updateSpectralFeatures();
+
+// Feed one accelerometer sample at SpectralShape's rate directly (g)
+void pushSpectralSample(float ax, float ay, float az);
+
+// True once a full window has been seen
+bool spectralReady();
+
+// Band energy for one accel axis (0 = x, 1 = y, 2 = z), in g^2 (sum of squared
+// sinusoid amplitudes of the band's bins)
+float getBandEnergy(int axis, SpectralBand band);
+
+// Band energy summed over the three axes
+float getTotalBandEnergy(SpectralBand band);
+
+// Share of the total (all bands) energy that falls in one band, 0-1
+float getBandShare(SpectralBand band);
+
+// True when recent accel energy is mostly road buzz / knock frequencies
+// (see SPECTRAL_LOW_SHARE_MIN and SPECTRAL_MIN_ENERGY in config.h)
+bool isVibrationDominated();
+
+// ---------------------------------------------------------------------------
+// Per window: the same bands, computed from the samples a detector scores
+// rather than from the live stream (which may be ahead of a lagging reader)
+// ---------------------------------------------------------------------------
+
+// Add the band energies (g^2) of one axis, n samples at rateHz, oldest first.
+// Each tracked bin is evaluated at its frequency with the Goertzel recursion
+// over segments as long as the streaming window (the newest n / segment of
+// them, mean removed, averaged), so any window length and rate works.
+void addSequenceBandEnergy(const float* x, int n, int rateHz, float (&energy)[BAND_COUNT]);
+
+// Same test as isVibrationDominated() on a set of band energies
+bool bandsVibrationDominated(const float (&energy)[BAND_COUNT]);
+
+// isVibrationDominated() over every sample of one window (accel rows)
+template <typename Shape>
+bool isWindowVibrationDominated(const SampleWindow<Shape>& w) {
+    if (!w.full) return false;
+    static float ordered[Shape::WINDOW_SIZE];
+    float energy[BAND_COUNT] = {0.0f, 0.0f, 0.0f};
+    for (int a = AXIS_AX; a <= AXIS_AZ; a++) {
+        int i = w.index;  // oldest sample of a full window
+        for (int t = 0; t < Shape::WINDOW_SIZE; t++) {
+            ordered[t] = w.axis[a][i];
+            if (++i == Shape::WINDOW_SIZE) i = 0;
+        }
+        addSequenceBandEnergy(ordered, Shape::WINDOW_SIZE, Shape::RATE_HZ, energy);
+    }
+    return bandsVibrationDominated(energy);
+}
+
+#endif
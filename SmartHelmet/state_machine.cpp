@@ -1,7 +1,6 @@
 #include <Arduino.h>
 #include "state_machine.h"
-//#include "crash_detector.h"  // Old threshold-based detector
-#include "ml_crash_detector.h"  // New ML-based detector
+#include "detector_manager.h"  // Production detector is chosen in config.h
 #include "mqtt_manager.h"
 #include "led.h"
 #include "button.h"
@@ -12,6 +11,10 @@ static State state = STATE_MONITOR;
 static unsigned long crashTime = 0;
 static unsigned long lastStateChange = 0;
 static bool cancelRequested = false;
+static bool detectorAlert = false;  // pending alert was raised by the production detector
+static bool alertPublished = false; // ACCIDENT_PENDING has gone out for this alert
+
+static_assert(PENDING_HOLD_MS < CANCEL_WINDOW_MS, "an alert must be published before it is confirmed");
 
 void initStateMachine() {
   state = STATE_MONITOR;
@@ -20,18 +23,22 @@ void initStateMachine() {
 void updateStateMachine() {
   if (state == STATE_MONITOR) {
     if (millis() - lastStateChange > 500) {
-      if (mlCrashDetected()) {  // Using ML model now!
-        float confidence = getMLConfidence();
-        Serial.print("STATE → CRASH_PENDING (ML confidence: ");
+      if (productionCrashDetected()) {
+        float confidence = getProductionConfidence();
+        Serial.print("STATE → CRASH_PENDING (");
+        Serial.print(getProductionDetectorName());
+        Serial.print(" confidence: ");
         Serial.print(confidence * 100);
         Serial.println("%)");
         state = STATE_PENDING;
+        detectorAlert = true;
         crashTime = millis();
         lastStateChange = millis();   
         ledOn();
-        publishAccidentPending();
-        // IMPORTANT: Reset ML detector immediately to prevent accumulation during pending state
-        resetMLCrashDetector();
+        // Published below once the detector's review allows (PENDING_HOLD_MS)
+        alertPublished = false;
+        // IMPORTANT: Reset detector immediately to prevent accumulation during pending state
+        resetProductionDetector();
       }
     }
   }
@@ -44,21 +51,42 @@ void updateStateMachine() {
     if (cancelRequested) {
       Serial.println("STATE → CANCELLED (False Alarm)");
       ledOff();
-      publishCrashCancelled(); 
-      // Ensure ML detector is fully reset
-      resetMLCrashDetector();   
+      if (alertPublished) publishCrashCancelled("USER_OVERRIDE");
+      // Ensure detector is fully reset
+      resetProductionDetector();   
       cancelRequested = false;
       state = STATE_MONITOR;
       lastStateChange = millis();  
       return;
     }
 
+    // Multi-stage detectors keep watching and can withdraw their own alert
+    DetectorVerdict verdict = detectorAlert ? reviewProductionTrigger() : VERDICT_CONFIRMED;
+    if (verdict == VERDICT_DOWNGRADED) {
+      Serial.print("STATE → CANCELLED (");
+      Serial.print(getProductionDetectorName());
+      Serial.println(" context downgrade)");
+      ledOff();
+      // Only a late verdict (after PENDING_HOLD_MS) was ever made public
+      if (alertPublished) publishCrashCancelled("CONTEXT_DOWNGRADE");
+      resetProductionDetector();
+      state = STATE_MONITOR;
+      lastStateChange = millis();
+      return;
+    }
+
+    if (detectorAlert && !alertPublished &&
+        (verdict == VERDICT_CONFIRMED || millis() - crashTime >= PENDING_HOLD_MS)) {
+      publishAccidentPending();
+      alertPublished = true;
+    }
+
     if (millis() - crashTime > CANCEL_WINDOW_MS) {
       Serial.println("STATE → CONFIRMED CRASH");
       ledOff();
       publishCrashConfirmed();
-      // Ensure ML detector is fully reset
-      resetMLCrashDetector();   
+      // Ensure detector is fully reset
+      resetProductionDetector();   
       state = STATE_MONITOR;
       lastStateChange = millis();  
     }
@@ -69,6 +97,8 @@ extern void onExternalAccidentPending() {
   if (state == STATE_MONITOR) {
     Serial.println("STATE → CRASH_PENDING (external)");
     state = STATE_PENDING;
+    detectorAlert = false;
+    alertPublished = true;  // the app raised it and has published it already
     crashTime = millis();
     lastStateChange = millis();  
     ledOn();
@@ -0,0 +1,222 @@
+#include "telemetry.h"
+#include "config.h"
+#include "sample_ring.h"
+#include "pipeline.h"
+#include "imu_filters.h"
+#include "detector_manager.h"
+#include "spectral_features.h"
+#include "mqtt_manager.h"
+#include <Arduino.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#define RAW_INTERVAL_MS ModelShape::SAMPLE_INTERVAL_MS  // same as the model input
+#define BATCH_PERIOD_MS 500        // raw levels: one message per 0.5 s
+#define SUMMARY_PERIOD_MS 1000     // summary level: one message per second
+#define BATCH_MAX (BATCH_PERIOD_MS / RAW_INTERVAL_MS + 1)
+
+// Quantization: accel in mg, gyro in 0.1 deg/s
+#define ACCEL_QUANT 1000.0f
+#define GYRO_QUANT 10.0f
+
+// Backpressure: a publish slower than this (or a failed one) drops a level;
+// this many fast publishes in a row raise it again
+#define SLOW_PUBLISH_US 20000
+#define RECOVER_AFTER 10
+
+#define PAYLOAD_SIZE 1200
+
+// Not called for this long (e.g. during data collection): telemetry was
+// paused, so the samples it missed are not backpressure
+#define RESUME_GAP_MS 1000
+
+static SampleCursor cursor;
+static uint32_t lastOverruns = 0;
+static unsigned long lastUpdate = 0;
+static TelemetryLevel level = TELEMETRY_RAW;
+static int fastStreak = 0;
+static uint32_t messageSeq = 0;
+
+// Current window
+static bool windowOpen = false;
+static unsigned long windowStart = 0;
+static float peakAccel = 0.0;
+static float peakGyro = 0.0;
+static ImuSample lastSample;
+
+// Current raw batch (quantized)
+static int16_t batchAccel[BATCH_MAX][3];
+static int16_t batchGyro[BATCH_MAX][3];
+static int batchCount = 0;
+static unsigned long lastKept = 0;
+
+static char payload[PAYLOAD_SIZE];
+static int payloadLen = 0;
+static bool payloadTruncated = false;
+
+static int16_t quantize(float v, float q) {
+    float x = v * q;
+    if (x > 32767.0f) x = 32767.0f;
+    if (x < -32768.0f) x = -32768.0f;
+    return (int16_t)lroundf(x);
+}
+
+static void append(const char* fmt, ...) {
+    if (payloadTruncated) return;
+    int room = PAYLOAD_SIZE - payloadLen;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(payload + payloadLen, room, fmt, args);
+    va_end(args);
+    if (n < 0 || n >= room) {
+        // Did not fit: the caller falls back to a summary message
+        payloadTruncated = true;
+        return;
+    }
+    payloadLen += n;
+}
+
+// First sample absolute, then per-axis deltas from the previous sample
+static void appendDeltas(const char* key, int16_t values[][3]) {
+    append(",\"%s\":[", key);
+    for (int i = 0; i < batchCount; i++) {
+        for (int k = 0; k < 3; k++) {
+            int v = (i == 0) ? values[i][k] : values[i][k] - values[i - 1][k];
+            append(i == 0 && k == 0 ? "%d" : ",%d", v);
+        }
+    }
+    append("]");
+}
+
+static unsigned long windowPeriod() {
+    return level == TELEMETRY_SUMMARY ? SUMMARY_PERIOD_MS : BATCH_PERIOD_MS;
+}
+
+static unsigned long keepInterval() {
+    return level == TELEMETRY_RAW_HALF ? 2 * RAW_INTERVAL_MS : RAW_INTERVAL_MS;
+}
+
+static void startWindow(unsigned long t) {
+    windowOpen = true;
+    windowStart = t;
+    peakAccel = 0.0;
+    peakGyro = 0.0;
+    batchCount = 0;
+}
+
+static void addSample(const ImuSample& s) {
+    if (!windowOpen) startWindow(s.timestampMs);
+
+    float a = sqrt(s.ax*s.ax + s.ay*s.ay + s.az*s.az);
+    float w = sqrt(s.gx*s.gx + s.gy*s.gy + s.gz*s.gz);
+    if (a > peakAccel) peakAccel = a;
+    if (w > peakGyro) peakGyro = w;
+    lastSample = s;
+
+    if (level == TELEMETRY_SUMMARY || batchCount >= BATCH_MAX) return;
+    if (batchCount > 0 && s.timestampMs - lastKept < keepInterval() - SAMPLE_SLACK_MS) return;
+    lastKept = s.timestampMs;
+    batchAccel[batchCount][0] = quantize(s.ax, ACCEL_QUANT);
+    batchAccel[batchCount][1] = quantize(s.ay, ACCEL_QUANT);
+    batchAccel[batchCount][2] = quantize(s.az, ACCEL_QUANT);
+    batchGyro[batchCount][0] = quantize(s.gx, GYRO_QUANT);
+    batchGyro[batchCount][1] = quantize(s.gy, GYRO_QUANT);
+    batchGyro[batchCount][2] = quantize(s.gz, GYRO_QUANT);
+    batchCount++;
+}
+
+static void buildPayload(bool summary) {
+    payloadLen = 0;
+    payloadTruncated = false;
+    append("{\"type\":\"TELEMETRY\",\"helmetId\":\"H001\",\"seq\":%lu,\"t\":%lu,\"span\":%lu",
+           (unsigned long)messageSeq, windowStart, lastSample.timestampMs - windowStart);
+    append(",\"peakA\":%.2f,\"peakW\":%.1f,\"pitch\":%.1f,\"roll\":%.1f,\"conf\":%.2f",
+           peakAccel, peakGyro,
+           pitchFrom(lastSample.ax, lastSample.ay, lastSample.az),
+           rollFrom(lastSample.ax, lastSample.ay, lastSample.az),
+           getProductionConfidence());
+    append(",\"bands\":[%.3f,%.3f,%.3f]",
+           getTotalBandEnergy(BAND_LOW), getTotalBandEnergy(BAND_MID), getTotalBandEnergy(BAND_HIGH));
+    if (summary) {
+        append(",\"mode\":\"summary\"}");
+        return;
+    }
+    append(",\"mode\":\"raw\",\"dt\":%lu,\"n\":%d", keepInterval(), batchCount);
+    appendDeltas("a", batchAccel);
+    appendDeltas("g", batchGyro);
+    append("}");
+}
+
+static void degrade() {
+    fastStreak = 0;
+    if (level != TELEMETRY_SUMMARY) {
+        level = (TelemetryLevel)(level + 1);
+        Serial.print("TELEMETRY: backing off to level ");
+        Serial.println(level);
+    }
+}
+
+static void recordPublish(bool ok, unsigned long elapsedUs) {
+    if (!ok || elapsedUs > SLOW_PUBLISH_US) {
+        degrade();
+        return;
+    }
+    if (++fastStreak >= RECOVER_AFTER && level != TELEMETRY_RAW) {
+        fastStreak = 0;
+        level = (TelemetryLevel)(level - 1);
+        Serial.print("TELEMETRY: recovering to level ");
+        Serial.println(level);
+    }
+}
+
+void initTelemetry() {
+    initSampleCursor(cursor);
+    lastOverruns = 0;
+    lastUpdate = millis();
+    level = TELEMETRY_RAW;
+    fastStreak = 0;
+    windowOpen = false;
+}
+
+void updateTelemetry() {
+#if TELEMETRY_ENABLED
+    if (millis() - lastUpdate > RESUME_GAP_MS) {
+        // Resuming after a pause: start from the newest samples
+        initSampleCursor(cursor);
+        lastOverruns = 0;
+        windowOpen = false;
+    }
+
+    // The loop stalled long enough to lose samples: treat it as backpressure
+    if (cursor.overruns != lastOverruns) {
+        lastOverruns = cursor.overruns;
+        degrade();
+    }
+
+    ImuSample s;
+    while (readSample(cursor, s)) {
+        addSample(s);
+        if (s.timestampMs - windowStart < windowPeriod()) continue;
+
+        // Window complete; leave later samples for the next call
+        buildPayload(level == TELEMETRY_SUMMARY);
+        if (payloadTruncated) {
+            // Large deltas (e.g. during an impact) overflowed the raw batch
+            buildPayload(true);
+        }
+        unsigned long start = micros();
+        bool ok = publishTelemetry(payload);
+        recordPublish(ok, micros() - start);
+        messageSeq++;
+        windowOpen = false;
+        break;
+    }
+    // After the publish, so a slow publish is not mistaken for a pause
+    lastUpdate = millis();
+#endif
+}
+
+TelemetryLevel getTelemetryLevel() {
+    return level;
+}
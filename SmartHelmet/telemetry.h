@@ -0,0 +1,24 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// Live motion telemetry on helmet/H001/telemetry.
+// Samples come from the shared sample ring and are batched into one MQTT
+// message per period (quantized, delta-encoded). When publishing gets slow or
+// fails, the stream drops to half rate and then to per-window summaries
+// (peak |a|, peak |w|, orientation, detector confidence, vibration band
+// energies) until the link recovers.
+
+enum TelemetryLevel {
+    TELEMETRY_RAW,       // every 50Hz sample
+    TELEMETRY_RAW_HALF,  // every other sample (25Hz)
+    TELEMETRY_SUMMARY    // summaries only
+};
+
+void initTelemetry();
+
+// Call from loop() after handleMQTT(); publishes at most one message per call
+void updateTelemetry();
+
+TelemetryLevel getTelemetryLevel();
+
+#endif
@@ -0,0 +1,140 @@
+// Microbenchmark: window feature extraction over the original array-of-structs
+// buffer vs the structure-of-arrays window with batch kernels, with the window
+// length known at run time and fixed at compile time (pipeline.h).
+//
+// Build and run instructions are in README.md.
+
+#include "feature_kernels.h"
+#include "pipeline.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#define WINDOW_SIZE ModelShape::WINDOW_SIZE
+#define FEATURES ModelShape::FEATURES
+
+typedef SampleWindow<ModelShape> Window;
+
+struct Summary {
+    float maxAccel, maxGyro, accelVariance, gyroVariance;
+};
+
+// The original two-pass loop from ml_crash_detector.cpp
+static Summary featuresAoS(const float buf[WINDOW_SIZE][FEATURES]) {
+    float maxAccel = 0, maxGyro = 0, accelMean = 0, gyroMean = 0;
+    for (int i = 0; i < WINDOW_SIZE; i++) {
+        float a = sqrtf(buf[i][0]*buf[i][0] + buf[i][1]*buf[i][1] + buf[i][2]*buf[i][2]);
+        float g = sqrtf(buf[i][3]*buf[i][3] + buf[i][4]*buf[i][4] + buf[i][5]*buf[i][5]);
+        accelMean += a;
+        gyroMean += g;
+        if (a > maxAccel) maxAccel = a;
+        if (g > maxGyro) maxGyro = g;
+    }
+    accelMean /= WINDOW_SIZE;
+    gyroMean /= WINDOW_SIZE;
+    float accelVar = 0, gyroVar = 0;
+    for (int i = 0; i < WINDOW_SIZE; i++) {
+        float a = sqrtf(buf[i][0]*buf[i][0] + buf[i][1]*buf[i][1] + buf[i][2]*buf[i][2]);
+        float g = sqrtf(buf[i][3]*buf[i][3] + buf[i][4]*buf[i][4] + buf[i][5]*buf[i][5]);
+        accelVar += (a - accelMean) * (a - accelMean);
+        gyroVar += (g - gyroMean) * (g - gyroMean);
+    }
+    return {maxAccel, maxGyro, accelVar / WINDOW_SIZE, gyroVar / WINDOW_SIZE};
+}
+
+// Same features through the batch kernels (mirrors runInference())
+template <bool Scalar>
+static Summary featuresSoA(const Window& w) {
+    static float a[WINDOW_SIZE], g[WINDOW_SIZE];
+    float lo, maxA, maxG;
+    if (Scalar) {
+        magnitude3Scalar(w.axis[AXIS_AX], w.axis[AXIS_AY], w.axis[AXIS_AZ], a, WINDOW_SIZE);
+        magnitude3Scalar(w.axis[AXIS_GX], w.axis[AXIS_GY], w.axis[AXIS_GZ], g, WINDOW_SIZE);
+        minMaxScalar(a, WINDOW_SIZE, &lo, &maxA);
+        minMaxScalar(g, WINDOW_SIZE, &lo, &maxG);
+        float ma = sumOfScalar(a, WINDOW_SIZE) / WINDOW_SIZE;
+        float mg = sumOfScalar(g, WINDOW_SIZE) / WINDOW_SIZE;
+        normalizeIntoScalar(a, a, WINDOW_SIZE, ma, 1.0f);
+        normalizeIntoScalar(g, g, WINDOW_SIZE, mg, 1.0f);
+        return {maxA, maxG, dotProductScalar(a, a, WINDOW_SIZE) / WINDOW_SIZE,
+                dotProductScalar(g, g, WINDOW_SIZE) / WINDOW_SIZE};
+    }
+    magnitude3(w.axis[AXIS_AX], w.axis[AXIS_AY], w.axis[AXIS_AZ], a, WINDOW_SIZE);
+    magnitude3(w.axis[AXIS_GX], w.axis[AXIS_GY], w.axis[AXIS_GZ], g, WINDOW_SIZE);
+    minMax(a, WINDOW_SIZE, &lo, &maxA);
+    minMax(g, WINDOW_SIZE, &lo, &maxG);
+    float ma = sumOf(a, WINDOW_SIZE) / WINDOW_SIZE;
+    float mg = sumOf(g, WINDOW_SIZE) / WINDOW_SIZE;
+    normalizeInto(a, a, WINDOW_SIZE, ma, 1.0f);
+    normalizeInto(g, g, WINDOW_SIZE, mg, 1.0f);
+    return {maxA, maxG, dotProduct(a, a, WINDOW_SIZE) / WINDOW_SIZE,
+            dotProduct(g, g, WINDOW_SIZE) / WINDOW_SIZE};
+}
+
+// Fixed-length kernels, as the detectors use them (computeWindowFeatures)
+static Summary featuresFixed(const Window& w) {
+    WindowFeatures f;
+    computeWindowFeatures(w, f);
+    return {f.maxAccel, f.maxGyro, f.accelVariance, f.gyroVariance};
+}
+
+template <typename F>
+static double nsPerWindow(F&& fn, int iterations) {
+    volatile float sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        Summary f = fn();
+        sink = sink + f.maxAccel + f.accelVariance + f.gyroVariance;
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+static bool close(float a, float b) {
+    return std::fabs(a - b) <= 1e-3f * (1.0f + std::fabs(a));
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+
+    std::mt19937 rng(42);
+    std::normal_distribution<float> accel(0.0f, 1.5f), gyro(0.0f, 150.0f);
+
+    static float aos[WINDOW_SIZE][FEATURES];
+    static Window soa;
+    resetSampleWindow(soa);
+    for (int i = 0; i < WINDOW_SIZE; i++) {
+        float s[FEATURES] = {accel(rng), accel(rng), accel(rng), gyro(rng), gyro(rng), gyro(rng)};
+        for (int f = 0; f < FEATURES; f++) aos[i][f] = s[f];
+        pushSample(soa, ImuSample{0, 0, s[0], s[1], s[2], s[3], s[4], s[5]});
+    }
+
+    Summary ref = featuresAoS(aos);
+    Summary vec = featuresSoA<false>(soa);
+    Summary sca = featuresSoA<true>(soa);
+    Summary fix = featuresFixed(soa);
+    bool ok = close(ref.maxAccel, vec.maxAccel) && close(ref.maxGyro, vec.maxGyro) &&
+              close(ref.accelVariance, vec.accelVariance) && close(ref.gyroVariance, vec.gyroVariance) &&
+              close(ref.accelVariance, sca.accelVariance) && close(ref.gyroVariance, sca.gyroVariance) &&
+              close(ref.maxAccel, fix.maxAccel) && close(ref.maxGyro, fix.maxGyro) &&
+              close(ref.accelVariance, fix.accelVariance) && close(ref.gyroVariance, fix.gyroVariance);
+    if (!ok) {
+        fprintf(stderr, "kernel mismatch: AoS var=(%f,%f) SoA var=(%f,%f)\n",
+                ref.accelVariance, ref.gyroVariance, vec.accelVariance, vec.gyroVariance);
+        return 1;
+    }
+
+    double tAoS = nsPerWindow([&] { return featuresAoS(aos); }, iterations);
+    double tScalar = nsPerWindow([&] { return featuresSoA<true>(soa); }, iterations);
+    double tSoA = nsPerWindow([&] { return featuresSoA<false>(soa); }, iterations);
+    double tFixed = nsPerWindow([&] { return featuresFixed(soa); }, iterations);
+
+    printf("window=%d samples, %d iterations\n", WINDOW_SIZE, iterations);
+    printf("  AoS two-pass (original) : %8.1f ns/window\n", tAoS);
+    printf("  SoA scalar reference    : %8.1f ns/window  (%.2fx)\n", tScalar, tAoS / tScalar);
+    printf("  SoA batch kernels       : %8.1f ns/window  (%.2fx)\n", tSoA, tAoS / tSoA);
+    printf("  SoA fixed-length kernels: %8.1f ns/window  (%.2fx)\n", tFixed, tAoS / tFixed);
+    return 0;
+}
@@ -0,0 +1,452 @@
+// Golden-vector conformance and latency regression check for the firmware
+// inference path (ml_crash_detector.h: normalizeModelInput() + runModelCore(),
+// the model without the firmware's spectral gate).
+//
+// Input is golden_vectors.csv exported by the last cells of
+// ml-data/Smart_Helmet_ML_Training.ipynb: raw test windows, the normalized
+// tensor the model saw, and the Keras and TFLite outputs. Each window is
+// pushed through a SampleWindow<ModelShape> exactly as the detectors fill
+// theirs, then checked in three steps:
+//
+//   input    firmware tensor vs notebook tensor (scaler, axis and time order)
+//   output   runModelCore() vs the TFLite output, within --tol and on the same
+//            side of the alarm threshold, window by window; windows the
+//            baseline lists as known mismatches must keep their recorded output
+//   latency  per-window time of the whole path vs the stored baseline; a
+//            baseline without latency lines fails unless --no-latency
+//
+// make_golden_vectors.py writes a file in the same format from any corpus,
+// with the label as the reference output (model_baseline_synthetic.txt).
+//
+// Exits nonzero when a check fails, so it can gate changes to the pipeline.
+
+#include "host_harness.h"
+#include "config.h"
+#include "pipeline.h"
+#include "ml_crash_detector.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Same as THRESHOLD in ml_crash_detector.cpp
+#define MODEL_THRESHOLD 0.5f
+
+// The firmware and the notebook compute the same float32 affine transform;
+// anything beyond rounding is a scaler or layout mismatch
+#define INPUT_TOL 1e-3f
+
+#define DEFAULT_TOL 0.05f        // output tolerance (TFLite quantization)
+#define DEFAULT_SLOWDOWN 0.25    // allowed latency increase over the baseline
+#define DEFAULT_REPEAT 2000      // path runs per timing round
+#define TIMING_ROUNDS 7          // per-window latency is the fastest round
+
+static const int N = ModelShape::WINDOW_SIZE;
+static const int F = ModelShape::FEATURES;
+
+struct GoldenWindow {
+    int id;
+    int label;
+    float kerasOut;
+    float tfliteOut;
+    int rows;
+    float raw[N][F];
+    float input[N][F];
+};
+
+// ---------------------------------------------------------------------------
+// Golden vectors
+// ---------------------------------------------------------------------------
+
+// Columns: window,label,keras_out,tflite_out,t,<F raw>,<F normalized>
+static bool parseRow(const std::string& line, float* v, int count) {
+    const char* p = line.data();
+    const char* end = p + line.size();
+    for (int i = 0; i < count; i++) {
+        auto r = std::from_chars(p, end, v[i]);
+        if (r.ec != std::errc()) return false;
+        p = r.ptr;
+        if (p < end && *p == ',') p++;
+        else if (i < count - 1) return false;
+    }
+    return true;
+}
+
+static bool loadGolden(const std::string& path, std::vector<GoldenWindow>& out) {
+    std::ifstream in(path);
+    if (!in) {
+        fprintf(stderr, "cannot open %s (export it with the notebook's golden vector cell)\n", path.c_str());
+        return false;
+    }
+    std::string line;
+    std::getline(in, line);
+    if (line.rfind("window,label,keras_out,tflite_out,t,", 0) != 0) {
+        fprintf(stderr, "%s: unexpected header\n", path.c_str());
+        return false;
+    }
+
+    const int columns = 5 + 2 * F;
+    float v[5 + 2 * IMU_AXES];
+    int lineNo = 1;
+    while (std::getline(in, line)) {
+        lineNo++;
+        if (line.empty()) continue;
+        if (!parseRow(line, v, columns)) {
+            fprintf(stderr, "%s:%d: malformed row (expected %d columns for %d features)\n",
+                    path.c_str(), lineNo, columns, F);
+            return false;
+        }
+        int id = (int)v[0];
+        int t = (int)v[4];
+        if (out.empty() || out.back().id != id) {
+            out.push_back(GoldenWindow{id, (int)v[1], v[2], v[3], 0, {}, {}});
+        }
+        GoldenWindow& w = out.back();
+        if (t != w.rows || t >= N) {
+            fprintf(stderr, "%s:%d: window %d sample %d out of order or past ModelShape's %d samples"
+                    " - re-export with WINDOW_SIZE = %d\n", path.c_str(), lineNo, id, t, N, N);
+            return false;
+        }
+        for (int f = 0; f < F; f++) {
+            w.raw[t][f] = v[5 + f];
+            w.input[t][f] = v[5 + F + f];
+        }
+        w.rows++;
+    }
+    for (const GoldenWindow& w : out) {
+        if (w.rows != N) {
+            fprintf(stderr, "%s: window %d has %d samples, ModelShape has %d\n", path.c_str(), w.id, w.rows, N);
+            return false;
+        }
+    }
+    return !out.empty();
+}
+
+static void fillWindow(const GoldenWindow& g, SampleWindow<ModelShape>& w) {
+    resetSampleWindow(w);
+    for (int t = 0; t < N; t++) {
+        ImuSample s = {};
+        s.seq = t;
+        s.timestampMs = t * ModelShape::SAMPLE_INTERVAL_MS;
+        s.ax = g.raw[t][AXIS_AX]; s.ay = g.raw[t][AXIS_AY]; s.az = g.raw[t][AXIS_AZ];
+        s.gx = g.raw[t][AXIS_GX]; s.gy = g.raw[t][AXIS_GY]; s.gz = g.raw[t][AXIS_GZ];
+        pushSample(w, s);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Baseline
+// ---------------------------------------------------------------------------
+
+// "key value" lines, '#' comments; written by --record. One line per golden
+// window records its expected output and whether that output is a known
+// mismatch with the TFLite output:
+//   window <id> <firmware output> ok|mismatch
+// Latency lines are host time, so a committed baseline may leave them out
+// (--record --no-latency) and each machine records its own.
+struct BaselineWindow {
+    float out;
+    bool mismatch;
+};
+
+struct Baseline {
+    bool loaded = false;
+    bool hasLatency = false;
+    std::map<int, BaselineWindow> windows;
+    double p50Ns = 0;
+    double p99Ns = 0;
+};
+
+static bool loadBaseline(const std::string& path, Baseline& b) {
+    std::ifstream in(path);
+    if (!in) return true;  // no baseline: b.loaded stays false
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(in, line)) {
+        lineNo++;
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream kv(line);
+        std::string key;
+        kv >> key;
+        if (key == "window") {
+            int id;
+            BaselineWindow w;
+            std::string status;
+            if (!(kv >> id >> w.out >> status) || (status != "ok" && status != "mismatch")) {
+                fprintf(stderr, "%s:%d: expected \"window <id> <output> ok|mismatch\"\n", path.c_str(), lineNo);
+                return false;
+            }
+            w.mismatch = status == "mismatch";
+            b.windows[id] = w;
+        } else if (key == "p50_ns") {
+            kv >> b.p50Ns;
+            b.hasLatency = true;
+        } else if (key == "p99_ns") {
+            kv >> b.p99Ns;
+        }
+    }
+    b.loaded = !b.windows.empty();
+    if (!b.loaded) {
+        fprintf(stderr, "%s: no window lines (baseline from an older check_model? re-record it)\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+// p50 < 0: no latency lines
+static bool writeBaseline(const std::string& path, const std::string& golden,
+                          const std::vector<GoldenWindow>& windows, const std::vector<float>& outputs,
+                          const std::vector<bool>& mismatch, double p50, double p99) {
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) return false;
+    fprintf(f, "# check_model baseline, written by check_model --record\n");
+    fprintf(f, "# golden: %s\n", golden.c_str());
+    fprintf(f, "# compiler: %s\n", __VERSION__);
+    if (p50 >= 0) {
+        fprintf(f, "# Latency is host time; re-record when the machine or flags change.\n");
+    } else {
+        fprintf(f, "# Output lines only: latency is host time, so each machine records its own\n");
+        fprintf(f, "# (check_model --record rewrites this file with it), or checks with --no-latency.\n");
+    }
+    for (size_t k = 0; k < windows.size(); k++) {
+        fprintf(f, "window %d %.6f %s\n", windows[k].id, outputs[k], mismatch[k] ? "mismatch" : "ok");
+    }
+    if (p50 >= 0) {
+        fprintf(f, "p50_ns %.1f\n", p50);
+        fprintf(f, "p99_ns %.1f\n", p99);
+    }
+    fclose(f);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Timing
+// ---------------------------------------------------------------------------
+
+static float inputTensor[N][F];
+static volatile float sink;
+
+// ns per normalizeModelInput() + runModelCore(). The fastest round is the one
+// least disturbed by the rest of the machine, so it is the most repeatable.
+static double timePath(const SampleWindow<ModelShape>& w, int repeat) {
+    double best = 0.0;
+    for (int r = 0; r < TIMING_ROUNDS; r++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < repeat; i++) {
+            normalizeModelInput(w, inputTensor);
+            sink = runModelCore(w);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / repeat;
+        if (r == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+static double percentile(std::vector<double> v, double q) {
+    std::sort(v.begin(), v.end());
+    double idx = q * (v.size() - 1);
+    size_t lo = (size_t)idx;
+    size_t hi = std::min(lo + 1, v.size() - 1);
+    return v[lo] + (v[hi] - v[lo]) * (idx - lo);
+}
+
+// ---------------------------------------------------------------------------
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-g golden.csv] [-b baseline] [--tol %.2f] [--max-slowdown %.2f] [--repeat %d]\n"
+            "          [--no-latency] [--record]\n"
+            "  golden defaults to ../ml-data/golden_vectors.csv, baseline to model_baseline.txt\n"
+            "  --no-latency skips the timing (and leaves it out of a recorded baseline)\n",
+            argv0, DEFAULT_TOL, DEFAULT_SLOWDOWN, DEFAULT_REPEAT);
+}
+
+int main(int argc, char** argv) {
+    std::string goldenPath = "../ml-data/golden_vectors.csv";
+    std::string baselinePath = "model_baseline.txt";
+    float tol = DEFAULT_TOL;
+    double maxSlowdown = DEFAULT_SLOWDOWN;
+    int repeat = DEFAULT_REPEAT;
+    bool record = false;
+    bool noLatency = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-g" && i + 1 < argc) {
+            goldenPath = argv[++i];
+        } else if (a == "-b" && i + 1 < argc) {
+            baselinePath = argv[++i];
+        } else if (a == "--tol" && i + 1 < argc) {
+            tol = (float)atof(argv[++i]);
+        } else if (a == "--max-slowdown" && i + 1 < argc) {
+            maxSlowdown = atof(argv[++i]);
+        } else if (a == "--repeat" && i + 1 < argc) {
+            repeat = std::max(1, atoi(argv[++i]));
+        } else if (a == "--record") {
+            record = true;
+        } else if (a == "--no-latency") {
+            noLatency = true;
+        } else {
+            usage(argv[0]);
+            return a == "-h" || a == "--help" ? 0 : 2;
+        }
+    }
+
+    std::vector<GoldenWindow> golden;
+    if (!loadGolden(goldenPath, golden)) return 2;
+
+    if (!initMLCrashDetector()) {
+        fprintf(stderr, "accident_model.h does not match ModelShape [1,%d,%d]\n", N, F);
+        return 1;
+    }
+
+    Baseline base;
+    if (!record && !loadBaseline(baselinePath, base)) return 2;
+
+    printf("golden:   %s, %zu windows of %d x %d (ModelShape at %d Hz)\n",
+           goldenPath.c_str(), golden.size(), N, F, ModelShape::RATE_HZ);
+
+    // Input tensor and output agreement
+    static SampleWindow<ModelShape> w;
+    fillWindow(golden[0], w);
+    if (!noLatency) timePath(w, repeat);  // warm-up: caches and CPU clock before the first timed window
+    float inputError = 0.0f, outputError = 0.0f, quantError = 0.0f;
+    int mismatches = 0, inputFailures = 0;
+    std::vector<float> outputs;
+    std::vector<bool> mismatch;
+    std::vector<double> latency;
+
+    for (size_t k = 0; k < golden.size(); k++) {
+        const GoldenWindow& g = golden[k];
+        fillWindow(g, w);
+
+        normalizeModelInput(w, inputTensor);
+        float err = 0.0f;
+        for (int t = 0; t < N; t++) {
+            for (int f = 0; f < F; f++) err = std::max(err, std::fabs(inputTensor[t][f] - g.input[t][f]));
+        }
+        inputError = std::max(inputError, err);
+        if (err > INPUT_TOL) inputFailures++;
+
+        float out = runModelCore(w);
+        float outErr = std::fabs(out - g.tfliteOut);
+        bool sameSide = (out >= MODEL_THRESHOLD) == (g.tfliteOut >= MODEL_THRESHOLD);
+        outputError = std::max(outputError, outErr);
+        quantError = std::max(quantError, std::fabs(g.kerasOut - g.tfliteOut));
+        outputs.push_back(out);
+        mismatch.push_back(outErr > tol || !sameSide);
+        if (mismatch.back()) mismatches++;
+
+        if (!noLatency) latency.push_back(timePath(w, repeat));
+    }
+
+    bool ok = true;
+
+    printf("input:    max |firmware - notebook| = %.2e (limit %.0e)", inputError, INPUT_TOL);
+    if (inputFailures) {
+        printf("  FAIL in %d windows: MEAN/SCALE in ml_crash_detector.cpp do not match scaler_params.json,"
+               " or the window layout changed\n", inputFailures);
+        ok = false;
+    } else {
+        printf("  ok\n");
+    }
+
+    // Window by window: a window must match TFLite unless the baseline lists
+    // it as a known mismatch, and a known mismatch must keep its recorded
+    // output, so it cannot hide a different error
+    printf("output:   max |firmware - TFLite| = %.4f, %d/%zu windows outside %.3f or across %.2f"
+           " (Keras vs TFLite: %.4f)\n", outputError, mismatches, golden.size(), tol, MODEL_THRESHOLD, quantError);
+    if (!record && !base.loaded) {
+        printf("          no baseline at %s: every window must match (record known mismatches with --record)\n",
+               baselinePath.c_str());
+    }
+    int failures = 0, fixed = 0;
+    for (size_t k = 0; k < golden.size() && !record; k++) {
+        const GoldenWindow& g = golden[k];
+        const char* reason = nullptr;
+        float expected = g.tfliteOut;
+        auto it = base.windows.find(g.id);
+        if (base.loaded && it == base.windows.end()) {
+            reason = "not in the baseline (different golden file? re-record)";
+        } else if (!base.loaded || !it->second.mismatch) {
+            if (mismatch[k]) reason = base.loaded ? "matched TFLite in the baseline" : "does not match TFLite";
+        } else {
+            expected = it->second.out;
+            if (std::fabs(outputs[k] - expected) > tol) reason = "known mismatch, but its output moved";
+            else if (!mismatch[k]) fixed++;
+        }
+        if (!reason) continue;
+        if (failures++ < 10) {
+            printf("  window %4d label=%d  firmware=%.3f TFLite=%.3f expected=%.3f  FAIL: %s\n",
+                   g.id, g.label, outputs[k], g.tfliteOut, expected, reason);
+        }
+    }
+    int known = 0;
+    for (const auto& b : base.windows) {
+        if (b.second.mismatch) known++;
+        bool found = false;
+        for (const GoldenWindow& g : golden) found = found || g.id == b.first;
+        if (!found && failures++ < 10) {
+            printf("  window %4d  FAIL: in the baseline but not in %s\n", b.first, goldenPath.c_str());
+        }
+    }
+    if (failures > 10) printf("  ... %d more\n", failures - 10);
+    if (!record) {
+        printf("          %s", failures ? "FAIL" : "ok");
+        if (base.loaded) printf(" (baseline lists %d known mismatches)", known);
+        if (fixed) printf(", %d of them now match TFLite: re-record", fixed);
+        printf("\n");
+    }
+    if (failures) ok = false;
+
+    double p50 = -1, p99 = -1;
+    if (noLatency) {
+        printf("latency:  not measured (--no-latency)\n");
+    } else {
+        p50 = percentile(latency, 0.5);
+        p99 = percentile(latency, 0.99);
+        printf("latency:  p50=%.0f ns  p99=%.0f ns per window (normalize + model, %d runs x %d rounds)",
+               p50, p99, repeat, TIMING_ROUNDS);
+    }
+    if (record || noLatency) {
+        if (!noLatency) printf("\n");
+    } else if (!base.hasLatency) {
+        // Otherwise a baseline without latency lines passes a slowdown unchecked
+        printf("  FAIL: no latency baseline in %s (record one on this machine with --record,"
+               " or check outputs only with --no-latency)\n", baselinePath.c_str());
+        ok = false;
+    } else {
+        double limit50 = base.p50Ns * (1.0 + maxSlowdown);
+        double limit99 = base.p99Ns * (1.0 + maxSlowdown);
+        bool slow = p50 > limit50 || p99 > limit99;
+        printf("\n          baseline p50=%.0f ns  p99=%.0f ns, limit +%.0f%%  %s\n",
+               base.p50Ns, base.p99Ns, maxSlowdown * 100, slow ? "FAIL" : "ok");
+        if (slow) ok = false;
+    }
+
+    if (record) {
+        if (inputFailures) {
+            fprintf(stderr, "not recording a baseline while the input check fails\n");
+            return 1;
+        }
+        if (!writeBaseline(baselinePath, goldenPath, golden, outputs, mismatch, p50, p99)) {
+            perror(baselinePath.c_str());
+            return 1;
+        }
+        printf("baseline: %d known mismatches%s written to %s\n", mismatches,
+               noLatency ? "" : " and the latency", baselinePath.c_str());
+        return 0;
+    }
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,41 @@
+#include "host_harness.h"
+#include "Arduino.h"
+#include "mpu6050.h"
+#include "sample_ring.h"
+
+HostSerial Serial;
+
+static unsigned long nowMs = 0;
+
+unsigned long millis() { return nowMs; }
+unsigned long micros() { return nowMs * 1000UL; }
+
+void hostSetMillis(unsigned long ms) { nowMs = ms; }
+
+// mpu6050.h backed by replayed samples instead of the I2C sensor
+static float ax, ay, az;
+static float gx, gy, gz;
+
+void hostSetImuSample(float sax, float say, float saz, float sgx, float sgy, float sgz) {
+    ax = sax; ay = say; az = saz;
+    gx = sgx; gy = sgy; gz = sgz;
+
+    // Same path as updateIMU(): one ring entry per reading
+    ImuSample s;
+    s.timestampMs = nowMs;
+    s.ax = ax; s.ay = ay; s.az = az;
+    s.gx = gx; s.gy = gy; s.gz = gz;
+    writeSample(s);
+}
+
+void initMPU() {}
+void updateIMU() {}
+bool isMPUReady() { return true; }
+
+float getAx() { return ax; }
+float getAy() { return ay; }
+float getAz() { return az; }
+
+float getGx() { return gx; }
+float getGy() { return gy; }
+float getGz() { return gz; }
@@ -0,0 +1,14 @@
+#ifndef HOST_HARNESS_H
+#define HOST_HARNESS_H
+
+// Host-side replacements for the hardware layer of the firmware.
+// host_harness.cpp provides millis()/micros() and the mpu6050.h getters.
+
+// Set the virtual clock returned by millis()/micros()
+void hostSetMillis(unsigned long ms);
+
+// Make a recorded sample the "current" IMU reading and write it to the
+// sample ring at the current virtual time
+void hostSetImuSample(float ax, float ay, float az, float gx, float gy, float gz);
+
+#endif
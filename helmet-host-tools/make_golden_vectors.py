@@ -0,0 +1,97 @@
+"""Write golden_vectors.csv-format windows from recorded or synthetic CSVs.
+
+The real golden vectors come from the training notebook (Step 13), which
+needs TensorFlow to produce the Keras and TFLite outputs. This script builds
+a file in the same format without it, so check_model and golden_serial.py
+can run from a fresh checkout:
+
+    raw        one ModelShape window (100 samples at 50Hz) per CSV: centred
+               on the largest |a| spike for accident and edge_case files,
+               the middle of the recording for normal files
+    in_*       raw scaled with ml-data/scaler_params.json, like the notebook
+    keras_out  the label (1.0 accident, 0.0 otherwise): there is no model
+    tflite_out here, so output "mismatches" are windows where the firmware
+               model disagrees with the label
+
+The window choice has no randomness: the same CSVs give the same file.
+
+Usage:
+    python make_golden_vectors.py <corpus_dir> [out.csv]
+                                  [--scaler ../ml-data/scaler_params.json]
+"""
+
+import argparse
+import csv
+import json
+import os
+
+WINDOW_SIZE = 100        # ModelShape::WINDOW_SIZE (pipeline.h)
+FEATURES = ['ax', 'ay', 'az', 'gx', 'gy', 'gz']
+CLASSES = ['normal', 'accident', 'edge_case']
+
+
+def load_rows(path):
+    with open(path, newline='') as f:
+        return [[float(row[name]) for name in FEATURES] for row in csv.DictReader(f)]
+
+
+def pick_window(rows, label):
+    """First sample of the window to export."""
+    if label == 'normal':
+        centre = len(rows) // 2
+    else:
+        deviation = [abs((r[0] ** 2 + r[1] ** 2 + r[2] ** 2) ** 0.5 - 1.0) for r in rows]
+        centre = max(range(len(rows)), key=lambda i: deviation[i])
+    return max(0, min(centre - WINDOW_SIZE // 2, len(rows) - WINDOW_SIZE))
+
+
+def find_files(corpus_dir):
+    """(label, path) for each CSV under corpus_dir/<class>/, sorted."""
+    files = []
+    for label in CLASSES:
+        folder = os.path.join(corpus_dir, label)
+        if not os.path.isdir(folder):
+            continue
+        for name in sorted(os.listdir(folder)):
+            if name.endswith('.csv'):
+                files.append((label, os.path.join(folder, name)))
+    return files
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Label-referenced golden vectors")
+    parser.add_argument('corpus_dir')
+    parser.add_argument('out', nargs='?', default='golden_synthetic.csv')
+    parser.add_argument('--scaler', default=os.path.join('..', 'ml-data', 'scaler_params.json'))
+    args = parser.parse_args()
+
+    with open(args.scaler) as f:
+        scaler = json.load(f)
+    mean, scale = scaler['mean'], scaler['scale']
+
+    windows = 0
+    with open(args.out, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['window', 'label', 'keras_out', 'tflite_out', 't'] + FEATURES +
+                        [f'in_{name}' for name in FEATURES])
+        for label, path in find_files(args.corpus_dir):
+            rows = load_rows(path)
+            if len(rows) < WINDOW_SIZE:
+                print(f"  skipping {path}: {len(rows)} samples, need {WINDOW_SIZE}")
+                continue
+            start = pick_window(rows, label)
+            target = 1 if label == 'accident' else 0
+            for t, raw in enumerate(rows[start:start + WINDOW_SIZE]):
+                scaled = [(raw[i] - mean[i]) / scale[i] for i in range(len(FEATURES))]
+                writer.writerow([windows, target, f'{target:.1f}', f'{target:.1f}', t] +
+                                [f'{v:.4f}' for v in raw] + [f'{v:.7g}' for v in scaled])
+            windows += 1
+
+    if windows == 0:
+        print(f"✗ No CSVs with {WINDOW_SIZE}+ samples under {args.corpus_dir}/{{{','.join(CLASSES)}}}")
+        raise SystemExit(2)
+    print(f"✓ {windows} windows written to {args.out} (reference = label)")
+
+
+if __name__ == "__main__":
+    main()
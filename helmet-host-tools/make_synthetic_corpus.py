@@ -0,0 +1,116 @@
+"""Write a small synthetic corpus for score_corpus and check_model.
+
+The files use the data_collector.py CSV format at 50Hz, one folder per class:
+
+    normal/     riding noise around 1 g
+    accident/   a 300 ms spike (~4 g on ax, ~300 dps on gx), then the helmet
+                lies on its side (ax and az swapped) until the end
+    edge_case/  a short 2.5 g bump every 4 s (drops, knocks)
+
+With --scenarios it writes two sets of accident files instead, each a hard
+knock (~3.9 g) followed 2.5 s later by a crash (~8 g spike, then lying on
+the side), for what a detector does right after an alert ends early:
+
+    accident/knock_cancel_crash_*  the rider holds the cancel button for
+                                   200 ms, 1.5 s after the knock (label
+                                   column "cancel" on those rows)
+    accident/knock_crash_*         no button: the knock alert is only ended
+                                   early if the detector's review withdraws it
+
+The signals are simple on purpose: they exercise the detectors and the
+scorer end to end, they are not a stand-in for recorded rides. The output
+only depends on --seed, so numbers quoted from it can be reproduced.
+
+Usage:
+    python make_synthetic_corpus.py [out_dir] [--seed 1] [--scenarios]
+"""
+
+import argparse
+import os
+import random
+
+CLASSES = [('normal', 12), ('accident', 12), ('edge_case', 8)]
+SAMPLE_INTERVAL_MS = 20   # 50Hz, same as data_collector.py recordings
+SPIKE_SAMPLES = 15        # accident spike length (300 ms)
+BUMP_PERIOD = 200         # edge_case bump every 200 samples (4 s)
+BUMP_SAMPLES = 3
+SCENARIO_FILES = 8        # per scenario
+KNOCK_SAMPLES = 3
+CRASH_AFTER_KNOCK = 125   # samples (2.5 s)
+CANCEL_AFTER_KNOCK = 75   # samples (1.5 s)
+CANCEL_SAMPLES = 10       # button held 200 ms
+
+
+def write_file(path, label, rng):
+    """Write one recording; the caller's rng fixes its length and content."""
+    n = rng.randint(1500, 3000)
+    impact = rng.randint(300, n - 300)
+    with open(path, 'w') as f:
+        f.write('timestamp_ms,ax,ay,az,gx,gy,gz,pitch,roll,label\n')
+        for i in range(n):
+            ax, ay, az = rng.gauss(0, .1), rng.gauss(0, .1), 1 + rng.gauss(0, .1)
+            gx, gy, gz = [rng.gauss(0, 10) for _ in range(3)]
+            if label == 'accident' and impact <= i < impact + SPIKE_SAMPLES:
+                ax += rng.gauss(4, 1)
+                gx += rng.gauss(300, 50)
+            if label == 'accident' and i >= impact + SPIKE_SAMPLES:
+                ax, az = az, ax
+            if label == 'edge_case' and i % BUMP_PERIOD < BUMP_SAMPLES:
+                ax += rng.gauss(2.5, .5)
+                gy += rng.gauss(150, 30)
+            f.write(f'{i * SAMPLE_INTERVAL_MS},{ax:.4f},{ay:.4f},{az:.4f},'
+                    f'{gx:.4f},{gy:.4f},{gz:.4f},0.00,0.00,{label}\n')
+
+
+def write_scenario(path, cancel, rng):
+    """Knock, optional rider cancel, then a crash (the file's impact onset:
+    the knock stays under half the crash's deviation from 1 g)."""
+    n = rng.randint(1500, 3000)
+    knock = rng.randint(300, n - 600)
+    crash = knock + CRASH_AFTER_KNOCK
+    with open(path, 'w') as f:
+        f.write('timestamp_ms,ax,ay,az,gx,gy,gz,pitch,roll,label\n')
+        for i in range(n):
+            ax, ay, az = rng.gauss(0, .1), rng.gauss(0, .1), 1 + rng.gauss(0, .1)
+            gx, gy, gz = [rng.gauss(0, 10) for _ in range(3)]
+            if knock <= i < knock + KNOCK_SAMPLES:
+                ax += rng.gauss(3.8, .2)
+                gy += rng.gauss(150, 30)
+            if crash <= i < crash + SPIKE_SAMPLES:
+                ax += rng.gauss(8, .5)
+                gx += rng.gauss(300, 50)
+            if i >= crash + SPIKE_SAMPLES:
+                ax, az = az, ax
+            label = 'accident'
+            if cancel and knock + CANCEL_AFTER_KNOCK <= i < knock + CANCEL_AFTER_KNOCK + CANCEL_SAMPLES:
+                label = 'cancel'
+            f.write(f'{i * SAMPLE_INTERVAL_MS},{ax:.4f},{ay:.4f},{az:.4f},'
+                    f'{gx:.4f},{gy:.4f},{gz:.4f},0.00,0.00,{label}\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Synthetic crash corpus")
+    parser.add_argument('out_dir', nargs='?', default='synthetic_corpus')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--scenarios', action='store_true',
+                        help="knock-then-crash files instead of the labelled corpus")
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    if args.scenarios:
+        folder = os.path.join(args.out_dir, 'accident')
+        os.makedirs(folder, exist_ok=True)
+        for name, cancel in [('knock_cancel_crash', True), ('knock_crash', False)]:
+            for k in range(SCENARIO_FILES):
+                write_scenario(os.path.join(folder, f'{name}_{k}.csv'), cancel, rng)
+        print(f"✓ {2 * SCENARIO_FILES} scenario files written to {folder} (seed {args.seed})")
+        return
+    for label, count in CLASSES:
+        os.makedirs(os.path.join(args.out_dir, label), exist_ok=True)
+        for k in range(count):
+            write_file(os.path.join(args.out_dir, label, f'{label}_{k}.csv'), label, rng)
+    print(f"✓ {sum(c for _, c in CLASSES)} files written to {args.out_dir} (seed {args.seed})")
+
+
+if __name__ == "__main__":
+    main()
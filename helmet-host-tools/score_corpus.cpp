@@ -0,0 +1,668 @@
+// Offline batch scorer: replays the CSVs written by ml-data/data_collector.py
+// through the firmware crash detectors and reports detection quality and cost.
+//
+// The detector sources are compiled unchanged from ../SmartHelmet. They keep
+// their state in file-scope statics, so each worker is a forked process with
+// its own copy; workers pull files off a shared queue (largest first) and write
+// results into shared memory.
+
+#include "host_harness.h"
+#include "config.h"
+#include "crash_detector.h"
+#include "ml_crash_detector.h"
+#include "impact_detector.h"
+#include "multires_detector.h"
+#include "spectral_features.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+// ---------------------------------------------------------------------------
+// Detectors under test
+// ---------------------------------------------------------------------------
+
+// Same ops tables the firmware selects between in config.h
+static const CrashDetectorOps* const DETECTORS[] = {
+    &mlDetector,
+    &thresholdDetector,
+    &impactDetector,
+    &multiResDetector,
+};
+
+// Mirrors the guards in state_machine.cpp
+#define STATE_CHANGE_GUARD_MS 500
+
+// ---------------------------------------------------------------------------
+// Shared results
+// ---------------------------------------------------------------------------
+
+enum Label { LABEL_NORMAL, LABEL_ACCIDENT, LABEL_EDGE_CASE, LABEL_COUNT, LABEL_UNKNOWN = -1 };
+static const char* LABEL_NAMES[LABEL_COUNT] = {"normal", "accident", "edge_case"};
+
+struct FileResult {
+    int label;
+    bool ok;
+    bool done;           // scoreFile() returned; false if the worker died on this file
+    long samples;
+    long durationMs;
+    int alarms;          // alerts that stood
+    int withdrawn;       // alerts the detector's own review downgraded
+    int cancelled;       // alerts the rider cancelled (rows labelled "cancel")
+    long firstAlarmMs;   // relative to file start, -1 if none
+    long firstPublishMs; // when that alert went out as ACCIDENT_PENDING, -1 if none
+    long impactMs;       // onset of the largest |a| spike
+    float peakAccel;
+    float peakConfidence;
+    double cpuNs;
+    long calls;
+    // Spectral stage (spectral_features.h)
+    float bandPeak[BAND_COUNT];   // largest total band energy seen, g^2
+    double bandShareSum[BAND_COUNT];
+    long spectralSamples;         // samples with a full spectral window
+    long vibrationSamples;        // ... of which isVibrationDominated()
+    // Window gate (isWindowVibrationDominated() on a ModelShape window), --spectral only
+    long gateWindows;             // full windows seen
+    long gateFlagged;             // ... that the gate flags
+    int gateAlarms;               // alerts raised while the current window was flagged
+    int raised;                   // alerts raised (stood or withdrawn)
+};
+
+// Per-call CPU cost histogram, COST_BUCKETS_PER_OCTAVE buckets per power of two
+#define COST_BUCKETS_PER_OCTAVE 4
+#define COST_BUCKETS (32 * COST_BUCKETS_PER_OCTAVE)
+
+struct WorkerStats {
+    uint64_t costHist[COST_BUCKETS];
+};
+
+struct Shared {
+    std::atomic<int> nextFile;
+};
+
+static int costBucket(double ns) {
+    if (ns < 1.0) return 0;
+    int b = (int)(std::log2(ns) * COST_BUCKETS_PER_OCTAVE);
+    return std::min(b, COST_BUCKETS - 1);
+}
+
+static double bucketNs(int b) {
+    return std::exp2((b + 0.5) / COST_BUCKETS_PER_OCTAVE);
+}
+
+// ---------------------------------------------------------------------------
+// CSV replay
+// ---------------------------------------------------------------------------
+
+struct MappedFile {
+    const char* data = nullptr;
+    size_t size = 0;
+};
+
+static bool mapFile(const std::string& path, MappedFile& out) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return false;
+    madvise(p, st.st_size, MADV_SEQUENTIAL);
+    out.data = (const char*)p;
+    out.size = st.st_size;
+    return true;
+}
+
+static void unmapFile(MappedFile& f) {
+    if (f.data) munmap((void*)f.data, f.size);
+    f.data = nullptr;
+}
+
+// Parse "timestamp_ms,ax,ay,az,gx,gy,gz,...,label" starting at p. button is
+// set when the label is "cancel" (the rider holds the cancel button on that
+// row). Returns false on a malformed row; p is always advanced past the end
+// of the line.
+static bool parseRow(const char*& p, const char* end, long& ts, float v[6], bool& button) {
+    const char* eol = (const char*)memchr(p, '\n', end - p);
+    if (!eol) eol = end;
+    const char* q = p;
+    p = eol < end ? eol + 1 : end;
+
+    const char* last = eol > q && eol[-1] == '\r' ? eol - 1 : eol;
+    button = last - q > 7 && memcmp(last - 7, ",cancel", 7) == 0;
+
+    auto r = std::from_chars(q, eol, ts);
+    if (r.ec != std::errc() || r.ptr >= eol || *r.ptr != ',') return false;
+    q = r.ptr + 1;
+    for (int i = 0; i < 6; i++) {
+        auto rf = std::from_chars(q, eol, v[i]);
+        if (rf.ec != std::errc()) return false;
+        q = rf.ptr;
+        if (q < eol && *q == ',') q++;
+        else if (i < 5) return false;
+    }
+    return true;
+}
+
+// Impact onset: first sample whose deviation from 1 g reaches half of the
+// file's peak deviation. Using the onset rather than the peak sample keeps
+// alarms raised on the rising edge of a spike from counting as "early".
+#define IMPACT_ONSET_FRACTION 0.5f
+
+struct AccelPoint {
+    long ts;
+    float deviation;  // | |a| - 1 g |
+};
+
+// --spectral: what the knock rejection would see, independent of
+// SPECTRAL_KNOCK_REJECT. A model-rate window of its own, fed from the ring
+// like the ML detector's, judged after every new sample.
+static WindowStage<ModelShape> gateStage;
+
+static void standAlarm(FileResult& res, long alertTs, long publishTs) {
+    res.alarms++;
+    if (res.firstAlarmMs < 0) {
+        res.firstAlarmMs = alertTs;  // when it was raised (LED on the helmet)
+        res.firstPublishMs = publishTs;
+    }
+}
+
+static void scoreFile(const std::string& path, const CrashDetectorOps& det, unsigned long& clock,
+                      FileResult& res, WorkerStats& stats, std::vector<AccelPoint>& accel, bool spectral) {
+    MappedFile f;
+    if (!mapFile(path, f)) return;
+
+    const char* p = f.data;
+    const char* end = f.data + f.size;
+    if (end - p >= 9 && memcmp(p, "timestamp", 9) == 0) {
+        const char* eol = (const char*)memchr(p, '\n', end - p);
+        p = eol ? eol + 1 : end;
+    }
+
+    // Leave a large gap between files so cooldowns and sample gates from the
+    // previous file never leak into this one
+    clock += 1000000;
+    hostSetMillis(clock);
+    det.reset();
+    resetSpectralFeatures();
+    resetStage(gateStage);
+    bool gateFlag = false;
+    clock += 1000000;
+    unsigned long base = clock;
+
+    unsigned long lastStateChange = 0;
+    unsigned long confirmAt = 0;
+    bool pending = false;
+    long alertTs = 0;
+    long publishTs = -1;  // ACCIDENT_PENDING sent for the pending alert
+    long firstTs = -1, lastTs = 0;
+
+    accel.clear();
+    long ts;
+    float v[6];
+    bool button;
+    while (p < end) {
+        if (!parseRow(p, end, ts, v, button)) continue;
+        if (firstTs < 0) firstTs = ts;
+        lastTs = ts;
+        res.samples++;
+
+        unsigned long now = base + (unsigned long)ts;
+        hostSetMillis(now);
+        hostSetImuSample(v[0], v[1], v[2], v[3], v[4], v[5]);
+
+        float a = std::sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+        accel.push_back({ts, std::fabs(a - 1.0f)});
+        if (a > res.peakAccel) res.peakAccel = a;
+
+        // The spectral stage runs every loop in the firmware, independent of state
+        updateSpectralFeatures();
+        if (spectralReady()) {
+            res.spectralSamples++;
+            if (isVibrationDominated()) res.vibrationSamples++;
+            for (int b = 0; b < BAND_COUNT; b++) {
+                float e = getTotalBandEnergy((SpectralBand)b);
+                if (e > res.bandPeak[b]) res.bandPeak[b] = e;
+                res.bandShareSum[b] += getBandShare((SpectralBand)b);
+            }
+        }
+        if (spectral && fillStage(gateStage) && gateStage.window.full) {
+            gateFlag = isWindowVibrationDominated(gateStage.window);
+            res.gateWindows++;
+            if (gateFlag) res.gateFlagged++;
+        }
+
+        if (pending) {
+            // Mirrors the cancel button and the review in state_machine.cpp
+            if (button) {
+                res.cancelled++;
+                det.reset();
+                pending = false;
+                lastStateChange = now;
+                continue;
+            }
+            DetectorVerdict verdict = det.review ? det.review() : VERDICT_CONFIRMED;
+            if (verdict == VERDICT_DOWNGRADED) {
+                res.withdrawn++;
+                det.reset();
+                pending = false;
+                lastStateChange = now;
+                continue;
+            }
+            if (publishTs < 0 && (verdict == VERDICT_CONFIRMED ||
+                                  now - confirmAt >= (unsigned long)PENDING_HOLD_MS)) {
+                publishTs = ts;
+            }
+            if (now - confirmAt <= (unsigned long)CANCEL_WINDOW_MS) continue;
+            // Cancel window expired: the alert stands, the state machine
+            // resets and returns to MONITOR
+            standAlarm(res, alertTs, publishTs);
+            det.reset();
+            pending = false;
+            lastStateChange = now;
+        }
+        if (lastStateChange && now - lastStateChange <= STATE_CHANGE_GUARD_MS) continue;
+
+        auto t0 = std::chrono::steady_clock::now();
+        bool hit = det.detect();
+        auto t1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        res.cpuNs += ns;
+        res.calls++;
+        stats.costHist[costBucket(ns)]++;
+
+        float conf = det.confidence();
+        if (conf > res.peakConfidence) res.peakConfidence = conf;
+
+        if (hit) {
+            res.raised++;
+            if (gateFlag) res.gateAlarms++;
+            alertTs = ts;
+            publishTs = -1;
+            det.reset();
+            pending = true;
+            confirmAt = now;
+            lastStateChange = now;
+        }
+    }
+
+    if (pending) {
+        // The recording ended inside the cancel window: nothing withdrew the
+        // alert, so it stands (published now if it was still held)
+        standAlarm(res, alertTs, publishTs >= 0 ? publishTs : lastTs);
+    }
+    if (firstTs >= 0) {
+        res.durationMs = lastTs - firstTs;
+        if (res.firstAlarmMs >= 0) res.firstAlarmMs -= firstTs;
+        if (res.firstPublishMs >= 0) res.firstPublishMs -= firstTs;
+        float peakDeviation = 0.0f;
+        for (const AccelPoint& pt : accel) peakDeviation = std::max(peakDeviation, pt.deviation);
+        for (const AccelPoint& pt : accel) {
+            if (pt.deviation >= IMPACT_ONSET_FRACTION * peakDeviation) {
+                res.impactMs = pt.ts - firstTs;
+                break;
+            }
+        }
+    }
+    clock = base + (unsigned long)std::max(lastTs, 0L);
+    res.ok = res.samples > 0;
+    unmapFile(f);
+}
+
+// ---------------------------------------------------------------------------
+// Corpus discovery
+// ---------------------------------------------------------------------------
+
+struct CorpusFile {
+    std::string path;
+    uintmax_t size;
+    int label;
+};
+
+static int labelFor(const fs::path& p) {
+    for (fs::path part = p.parent_path(); !part.empty() && part != part.parent_path();
+         part = part.parent_path()) {
+        for (int i = 0; i < LABEL_COUNT; i++) {
+            if (part.filename() == LABEL_NAMES[i]) return i;
+        }
+    }
+    std::string name = p.filename().string();
+    for (int i = 0; i < LABEL_COUNT; i++) {
+        if (name.rfind(std::string(LABEL_NAMES[i]) + "_", 0) == 0) return i;
+    }
+    return LABEL_UNKNOWN;
+}
+
+static void collect(const fs::path& root, std::vector<CorpusFile>& out) {
+    std::error_code ec;
+    if (fs::is_regular_file(root, ec)) {
+        out.push_back({root.string(), fs::file_size(root, ec), labelFor(root)});
+        return;
+    }
+    for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::end(it); it.increment(ec)) {
+        if (it->is_regular_file() && it->path().extension() == ".csv") {
+            out.push_back({it->path().string(), it->file_size(), labelFor(it->path())});
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Reporting
+// ---------------------------------------------------------------------------
+
+static double percentile(std::vector<double> v, double q) {
+    if (v.empty()) return NAN;
+    std::sort(v.begin(), v.end());
+    double idx = q * (v.size() - 1);
+    size_t lo = (size_t)idx;
+    size_t hi = std::min(lo + 1, v.size() - 1);
+    return v[lo] + (v[hi] - v[lo]) * (idx - lo);
+}
+
+static double histPercentile(const uint64_t* hist, uint64_t total, double q) {
+    uint64_t target = (uint64_t)(q * total);
+    uint64_t seen = 0;
+    for (int b = 0; b < COST_BUCKETS; b++) {
+        seen += hist[b];
+        if (seen > target) return bucketNs(b);
+    }
+    return bucketNs(COST_BUCKETS - 1);
+}
+
+static void printConfusion(const std::vector<CorpusFile>& files, const FileResult* results,
+                           float threshold, bool useAlarms) {
+    int tp = 0, fp = 0, fn = 0, tn = 0;
+    for (size_t i = 0; i < files.size(); i++) {
+        const FileResult& r = results[i];
+        if (!r.ok || r.label == LABEL_UNKNOWN) continue;
+        bool flagged = useAlarms ? r.alarms > 0 : r.peakConfidence >= threshold;
+        bool positive = r.label == LABEL_ACCIDENT;
+        if (flagged && positive) tp++;
+        else if (flagged) fp++;
+        else if (positive) fn++;
+        else tn++;
+    }
+    double precision = tp + fp ? (double)tp / (tp + fp) : NAN;
+    double recall = tp + fn ? (double)tp / (tp + fn) : NAN;
+    if (useAlarms) {
+        printf("  files: TP=%d FP=%d FN=%d TN=%d  precision=%.3f recall=%.3f\n",
+               tp, fp, fn, tn, precision, recall);
+    } else {
+        printf("  %.2f  precision=%.3f recall=%.3f  (TP=%d FP=%d FN=%d)\n",
+               threshold, precision, recall, tp, fp, fn);
+    }
+}
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-d ml|threshold|impact|multires] [-j workers] [--per-file] [--sweep] [--spectral] [path...]\n"
+            "  path defaults to ../ml-data/collected_data (directories are searched for *.csv)\n",
+            argv0);
+}
+
+int main(int argc, char** argv) {
+    const CrashDetectorOps* det = DETECTORS[0];
+    int workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    bool perFile = false, sweep = false, spectral = false;
+    std::vector<std::string> roots;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if ((a == "-d" || a == "--detector") && i + 1 < argc) {
+            std::string name = argv[++i];
+            det = nullptr;
+            for (const CrashDetectorOps* d : DETECTORS) {
+                if (name == d->name) det = d;
+            }
+            if (!det) {
+                fprintf(stderr, "unknown detector '%s'\n", name.c_str());
+                return 2;
+            }
+        } else if ((a == "-j" || a == "--jobs") && i + 1 < argc) {
+            workers = std::max(1, atoi(argv[++i]));
+        } else if (a == "--per-file") {
+            perFile = true;
+        } else if (a == "--sweep") {
+            sweep = true;
+        } else if (a == "--spectral") {
+            spectral = true;
+        } else if (a == "-h" || a == "--help") {
+            usage(argv[0]);
+            return 0;
+        } else {
+            roots.push_back(a);
+        }
+    }
+    if (roots.empty()) roots.push_back("../ml-data/collected_data");
+
+    std::vector<CorpusFile> files;
+    for (const std::string& r : roots) collect(r, files);
+    if (files.empty()) {
+        fprintf(stderr, "no CSV files found\n");
+        return 1;
+    }
+    // Largest first so the long tail is made of small files
+    std::sort(files.begin(), files.end(),
+              [](const CorpusFile& a, const CorpusFile& b) { return a.size > b.size; });
+    workers = std::min<int>(workers, (int)files.size());
+
+    size_t sharedBytes = sizeof(Shared) + files.size() * sizeof(FileResult) + workers * sizeof(WorkerStats);
+    void* mem = mmap(nullptr, sharedBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    Shared* shared = new (mem) Shared();
+    shared->nextFile.store(0);
+    FileResult* results = (FileResult*)((char*)mem + sizeof(Shared));
+    WorkerStats* stats = (WorkerStats*)(results + files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        results[i] = FileResult{files[i].label, false, false, 0, 0, 0, 0, 0, -1, -1, 0,
+                                0.0f, 0.0f, 0.0, 0, {}, {}, 0, 0, 0, 0, 0, 0};
+    }
+    memset(stats, 0, workers * sizeof(WorkerStats));
+
+    if (!det->init()) {
+        fprintf(stderr, "detector '%s' failed to initialize\n", det->name);
+        return 2;
+    }
+    initSpectralFeatures();  // inherited by the workers
+
+    auto wallStart = std::chrono::steady_clock::now();
+    std::vector<pid_t> pids;
+    for (int w = 0; w < workers; w++) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 1;
+        }
+        if (pid == 0) {
+            unsigned long clock = 0;
+            std::vector<AccelPoint> accel;
+            int i;
+            while ((i = shared->nextFile.fetch_add(1)) < (int)files.size()) {
+                scoreFile(files[i].path, *det, clock, results[i], stats[w], accel, spectral);
+                results[i].done = true;
+            }
+            _exit(0);
+        }
+        pids.push_back(pid);
+    }
+    // A worker that crashes loses the file it was on (the others keep
+    // draining the queue); the run must not pass as if that file were empty
+    int failedWorkers = 0;
+    for (pid_t pid : pids) {
+        int status;
+        if (waitpid(pid, &status, 0) < 0) {
+            perror("waitpid");
+            failedWorkers++;
+        } else if (WIFSIGNALED(status)) {
+            fprintf(stderr, "worker %d killed by signal %d (%s)\n", (int)pid, WTERMSIG(status),
+                    strsignal(WTERMSIG(status)));
+            failedWorkers++;
+        } else if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "worker %d exited with status %d\n", (int)pid, WEXITSTATUS(status));
+            failedWorkers++;
+        }
+    }
+    double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    // Aggregate
+    uintmax_t bytes = 0;
+    long samples = 0, calls = 0;
+    double cpuNs = 0;
+    double hours[LABEL_COUNT] = {0};
+    int alarms[LABEL_COUNT] = {0}, withdrawn[LABEL_COUNT] = {0}, cancelled[LABEL_COUNT] = {0};
+    int fileCount[LABEL_COUNT] = {0};
+    std::vector<double> ttdFromImpact, ttdFromStart, ttpFromImpact;
+    uint64_t hist[COST_BUCKETS] = {0};
+
+    for (size_t i = 0; i < files.size(); i++) {
+        if (!results[i].done) {
+            results[i].ok = false;  // partial result; also kept out of the confusion tables
+            fprintf(stderr, "not scored %s (its worker failed)\n", files[i].path.c_str());
+            continue;
+        }
+        const FileResult& r = results[i];
+        if (!r.ok) {
+            fprintf(stderr, "skipped %s (empty or unreadable)\n", files[i].path.c_str());
+            continue;
+        }
+        bytes += files[i].size;
+        samples += r.samples;
+        calls += r.calls;
+        cpuNs += r.cpuNs;
+        if (r.label != LABEL_UNKNOWN) {
+            hours[r.label] += r.durationMs / 3600000.0;
+            alarms[r.label] += r.alarms;
+            withdrawn[r.label] += r.withdrawn;
+            cancelled[r.label] += r.cancelled;
+            fileCount[r.label]++;
+        }
+        if (r.label == LABEL_ACCIDENT && r.firstAlarmMs >= 0) {
+            ttdFromImpact.push_back(r.firstAlarmMs - r.impactMs);
+            ttdFromStart.push_back(r.firstAlarmMs);
+            ttpFromImpact.push_back(r.firstPublishMs - r.impactMs);
+        }
+        if (perFile) {
+            printf("%-10s alarms=%d withdrawn=%d cancelled=%d first=%6ldms published=%6ldms impact=%6ldms "
+                   "peak|a|=%5.2fg conf=%.2f  %s\n",
+                   r.label == LABEL_UNKNOWN ? "?" : LABEL_NAMES[r.label], r.alarms, r.withdrawn, r.cancelled,
+                   r.firstAlarmMs, r.firstPublishMs, r.impactMs, r.peakAccel, r.peakConfidence,
+                   files[i].path.c_str());
+        }
+    }
+    for (int w = 0; w < workers; w++) {
+        for (int b = 0; b < COST_BUCKETS; b++) hist[b] += stats[w].costHist[b];
+    }
+
+    printf("detector: %s\n", det->name);
+    printf("corpus:   %zu files, %.1f MB, %ld samples, %d workers, %.2f s wall (%.1f MB/s)\n",
+           files.size(), bytes / 1e6, samples, workers, wallSec, bytes / 1e6 / wallSec);
+    for (int l = 0; l < LABEL_COUNT; l++) {
+        printf("  %-10s %5d files  %8.3f h  %5d alarms  %5d withdrawn  %5d cancelled\n", LABEL_NAMES[l],
+               fileCount[l], hours[l], alarms[l], withdrawn[l], cancelled[l]);
+    }
+
+    printf("detection (file level, accident = positive):\n");
+    printConfusion(files, results, 0.0f, true);
+
+    printf("false alarms per ride-hour:\n");
+    for (int l : {LABEL_NORMAL, LABEL_EDGE_CASE}) {
+        if (hours[l] > 0) printf("  %-10s %.2f\n", LABEL_NAMES[l], alarms[l] / hours[l]);
+        else printf("  %-10s n/a\n", LABEL_NAMES[l]);
+    }
+
+    printf("time to detect (accident files with an alarm: %zu):\n", ttdFromImpact.size());
+    if (!ttdFromImpact.empty()) {
+        printf("  from impact:    min=%.0f p10=%.0f p50=%.0f p90=%.0f max=%.0f ms\n",
+               percentile(ttdFromImpact, 0), percentile(ttdFromImpact, 0.1), percentile(ttdFromImpact, 0.5),
+               percentile(ttdFromImpact, 0.9), percentile(ttdFromImpact, 1));
+        printf("  from recording: min=%.0f p50=%.0f max=%.0f ms\n",
+               percentile(ttdFromStart, 0), percentile(ttdFromStart, 0.5), percentile(ttdFromStart, 1));
+        printf("  published:      min=%.0f p50=%.0f p90=%.0f max=%.0f ms after impact\n",
+               percentile(ttpFromImpact, 0), percentile(ttpFromImpact, 0.5), percentile(ttpFromImpact, 0.9),
+               percentile(ttpFromImpact, 1));
+    }
+
+    printf("cost per detector call (one call per sample):\n");
+    if (calls > 0) {
+        printf("  mean=%.0f ns  p50~%.0f ns  p99~%.0f ns  (%ld calls)\n", cpuNs / calls,
+               histPercentile(hist, calls, 0.5), histPercentile(hist, calls, 0.99), calls);
+    }
+
+    if (sweep) {
+        printf("threshold sweep on peak confidence (first alarm only):\n");
+        for (int t = 1; t <= 9; t++) printConfusion(files, results, t / 10.0f, false);
+    }
+
+    if (spectral) {
+        printf("spectral features by class (bands: low / mid / high, SPECTRAL_KNOCK_REJECT=%d):\n",
+               SPECTRAL_KNOCK_REJECT);
+        for (int l = 0; l < LABEL_COUNT; l++) {
+            std::vector<double> peak[BAND_COUNT];
+            double shareSum[BAND_COUNT] = {0};
+            long n = 0, vib = 0;
+            for (size_t i = 0; i < files.size(); i++) {
+                const FileResult& r = results[i];
+                if (!r.ok || r.label != l || r.spectralSamples == 0) continue;
+                for (int b = 0; b < BAND_COUNT; b++) {
+                    peak[b].push_back(r.bandPeak[b]);
+                    shareSum[b] += r.bandShareSum[b];
+                }
+                n += r.spectralSamples;
+                vib += r.vibrationSamples;
+            }
+            if (n == 0) continue;
+            printf("  %-10s mean share %.2f / %.2f / %.2f  median peak %.3f / %.3f / %.3f g^2  "
+                   "vibration-dominated %.1f%% of samples\n",
+                   LABEL_NAMES[l], shareSum[0] / n, shareSum[1] / n, shareSum[2] / n,
+                   percentile(peak[0], 0.5), percentile(peak[1], 0.5), percentile(peak[2], 0.5),
+                   100.0 * vib / n);
+        }
+        printf("window gate (isWindowVibrationDominated() on the %d ms model window):\n", ModelShape::WINDOW_MS);
+        for (int l = 0; l < LABEL_COUNT; l++) {
+            long windows = 0, flagged = 0;
+            int raised = 0, gated = 0;
+            for (size_t i = 0; i < files.size(); i++) {
+                const FileResult& r = results[i];
+                if (!r.ok || r.label != l) continue;
+                windows += r.gateWindows;
+                flagged += r.gateFlagged;
+                raised += r.raised;
+                gated += r.gateAlarms;
+            }
+            if (windows == 0) continue;
+            printf("  %-10s flags %.1f%% of windows, %d of %d raised alerts\n", LABEL_NAMES[l],
+                   100.0 * flagged / windows, gated, raised);
+        }
+    }
+
+    munmap(mem, sharedBytes);
+    if (failedWorkers) {
+        fprintf(stderr, "FAILED: %d of %d workers did not finish; the numbers above are incomplete\n",
+                failedWorkers, workers);
+        return 1;
+    }
+    return 0;
+}
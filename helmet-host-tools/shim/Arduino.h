@@ -0,0 +1,33 @@
+// Minimal Arduino API for compiling firmware detection code on the host.
+// Only what the detector translation units use is provided; time is virtual
+// and advanced by the host program through hostSetMillis().
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PI 3.1415926535897932384626433832795
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+
+// Serial output is discarded on the host
+class HostSerial {
+public:
+    template <typename T> void print(const T&) {}
+    template <typename T> void print(const T&, int) {}
+    template <typename T> void println(const T&) {}
+    template <typename T> void println(const T&, int) {}
+    void println() {}
+};
+
+extern HostSerial Serial;
+
+#endif
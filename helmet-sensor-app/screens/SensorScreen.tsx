@@ -127,17 +127,22 @@ const SensorScreen: React.FC = () => {
                         break;
 
 
-                    case 'CRASH_CANCELLED':
-                        console.log('✅ Accident cancelled by ESP32 button');
+                    case 'CRASH_CANCELLED': {
+                        const withdrawn = event.reason === 'CONTEXT_DOWNGRADE';
+                        console.log(withdrawn ? '↩️ Alert withdrawn by the helmet detector'
+                                              : '✅ Accident cancelled by ESP32 button');
                         setAccidentState('CANCELLED');
                         setShowAlert(false);
                         sensorService.resetAlertState(); // ✅ Reset to allow next detection
                         // Show cancelled message
                         setTimeout(() => {
-                            Alert.alert('✓ False Alarm', 'Accident cancelled by helmet button');
+                            Alert.alert('✓ False Alarm', withdrawn
+                                ? 'The helmet ruled out a crash'
+                                : 'Accident cancelled by helmet button');
                             setAccidentState('IDLE');
                         }, 100);
                         break;
+                    }
 
 
                     case 'CRASH_CONFIRMED':
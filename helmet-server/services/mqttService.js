@@ -85,6 +85,14 @@ function handleHelmetEvent(event) {
             break;
 
         case 'CRASH_CANCELLED':
+            if (event.reason === 'CONTEXT_DOWNGRADE') {
+                // The helmet's own detector withdrew the alert: no rider
+                // involvement and no accident to record
+                console.log("   ↩️ Withdrawn by the helmet detector");
+                pendingCache.delete(helmetId);
+                break;
+            }
+
             console.log("   ✅ Cancelled");
 
             const cancelCache = pendingCache.get(helmetId) || {};
@@ -4,6 +4,11 @@
 #ifndef ACCIDENT_MODEL_H
 #define ACCIDENT_MODEL_H
 
+// Input shape, checked against ModelShape (pipeline.h) at compile time
+#define ACCIDENT_MODEL_RATE_HZ 50
+#define ACCIDENT_MODEL_WINDOW_SIZE 100
+#define ACCIDENT_MODEL_FEATURES 6
+
 const unsigned int accident_model_len = 10192;
 const unsigned char accident_model[] = {
   0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xb4, 0x16, 0x00, 0x00, 0xc4, 0x16, 0x00, 0x00, 0x0c, 0x27, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe2, 0xe6, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd2, 0xe9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xcc, 0x15, 0x00, 0x00, 0xc4, 0x15, 0x00, 0x00, 0xb0, 0x15, 0x00, 0x00, 0x94, 0x15, 0x00, 0x00, 0x80, 0x15, 0x00, 0x00, 0x30, 0x15, 0x00, 0x00, 0x20, 0x0d, 0x00, 0x00, 0xd0, 0x0c, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0xb0, 0x07, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x44, 0x07, 0x00, 0x00, 0x28, 0x07, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc6, 0xea, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xea, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xa9, 0xf2, 0x04, 0x0a, 0x7c, 0x91, 0xba, 0x96, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x39, 0x2e, 0x30, 0x00, 0x00, 0x32, 0xeb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xdb, 0xff, 0xff, 0x10, 0xdb, 0xff, 0xff, 0x14, 0xdb, 0xff, 0xff, 0x18, 0xdb, 0xff, 0xff, 0x1c, 0xdb, 0xff, 0xff, 0x20, 0xdb, 0xff, 0xff, 0x24, 0xdb, 0xff, 0xff, 0x28, 0xdb, 0xff, 0xff, 0x2c, 0xdb, 0xff, 0xff, 0x30, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x38, 0xdb, 0xff, 0xff, 0x3c, 0xdb, 0xff, 0xff, 0x82, 0xeb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xc1, 0xc3, 0x91, 0xed, 0x2e, 0xd3, 0x17, 0xaa, 0x67, 0xc1, 0xde, 0x31, 0x2f, 0x00, 0x3a, 0xd6, 0x3e, 0xfc, 0x21, 0x81, 0xd9, 0xea, 0xf6, 0x9f, 0x2a, 0x11, 0x9c, 0xe7, 0xc8, 0x4f, 0xed, 0x5e, 0x95, 0xc8, 0xa4, 0x1a, 0xd0, 0x11, 0xee, 0xb4, 0x8e, 0x4e, 0xe6, 0x47, 0xd9, 0xcb, 0xaa, 0x0a, 0x33, 0xe5, 0x32, 0x02, 0x50, 0x9e, 0x47, 0x92, 0x14, 0xbd, 0x9d, 0xb2, 0xf4, 0x2d, 0x34, 0xfa, 0x3d, 0x93, 0x3a, 0x0b, 0xce, 0xd2, 0x1f, 0x81, 0xb3, 0x0a, 0xef, 0x96, 0xe5, 0x1e, 0xf8, 0xe9, 0xd0, 0xd2, 0xef, 0xd7, 0xe2, 0xac, 0x9f, 0x85, 0x4f, 0x4e, 0xf3, 0xdf, 0xa4, 0xe6, 0x1d, 0x94, 0x0f, 0x2d, 0x47, 0x02, 0x2f, 0x30, 0x4c, 0x1a, 0x17, 0xdf, 0xf0, 0x0c, 0x04, 0x47, 0x49, 0xaf, 0xf3, 0x3c, 0xdb, 0x20, 0xce, 0x1b, 0x3c, 0x24, 0x6b, 0xed, 0x32, 0x8b, 0xc7, 0xfc, 0x6e, 0x23, 0x69, 0x7f, 0x62, 0x50, 0x22, 0xc4, 0xd1, 0x2c, 0xf3, 0xfe, 0xf6, 0x11, 0xc2, 0x09, 0x29, 0xf1, 0x23, 0x0d, 0x7d, 0xd5, 0x19, 0x49, 0xe9, 0x59, 0x71, 0x12, 0x1a, 0xbe, 0x01, 0x31, 0x0a, 0xcd, 0x61, 0x2c, 0x48, 0xf5, 0xf8, 0x41, 0xe4, 0xc3, 0x29, 0x3f, 0xf9, 0xcc, 0xde, 0xdb, 0x51, 0xed, 0x07, 0x3a, 0x0d, 0x23, 0x37, 0x57, 0xdf, 0x0c, 0x71, 0xd5, 0x53, 0xed, 0xe6, 0x50, 0x7f, 0xfa, 0x9f, 0x27, 0xb6, 0x68, 0xa5, 0x4f, 0x20, 0x3f, 0xf8, 0xb3, 0x2b, 0x2f, 0x11, 0xd1, 0x12, 0x4f, 0xcb, 0x03, 0xe3, 0x56, 0x2e, 0x31, 0xdf, 0xc6, 0xe4, 0xf5, 0xd3, 0xbf, 0x7f, 0xd7, 0xbb, 0x67, 0xb3, 0xf9, 0xd0, 0x1b, 0xe1, 0x49, 0xfa, 0x00, 0x19, 0xd2, 0xc7, 0x06, 0x35, 0xac, 0xd5, 0x58, 0xcc, 0xc3, 0xfc, 0x49, 0xbe, 0x64, 0xd7, 0x11, 0xdc, 0x7e, 0x15, 0x6b, 0x41, 0xd8, 0x0a, 0xf1, 0x51, 0xef, 0x3f, 0x68, 0x62, 0xaa, 0xff, 0x3b, 0x05, 0xd1, 0x53, 0x7f, 0x58, 0x57, 0x23, 0x40, 0x5c, 0xe8, 0xca, 0x6a, 0x28, 0x2e, 0xf9, 0xb8, 0x33, 0x23, 0x01, 0x34, 0xdc, 0x1d, 0x39, 0x55, 0x7f, 0x14, 0x62, 0x26, 0x4d, 0x17, 0xc9, 0x09, 0x15, 0x57, 0x64, 0xa1, 0x29, 0x5d, 0x0f, 0xc8, 0xec, 0x47, 0x4f, 0xe8, 0x1d, 0xcb, 0x3f, 0x14, 0x43, 0x0a, 0xdd, 0x3f, 0xf7, 0x1e, 0x57, 0x1d, 0x52, 0x3c, 0x3d, 0x6c, 0xdb, 0x60, 0x32, 0x50, 0x45, 0x2e, 0x5f, 0xee, 0xf9, 0xd5, 0x72, 0x43, 0x24, 0x52, 0x24, 0x6e, 0x28, 0x65, 0x37, 0xc2, 0xf0, 0x34, 0xdb, 0xb7, 0x76, 0x08, 0xb4, 0x14, 0x3d, 0x2a, 0xa7, 0xb3, 0x9a, 0xdf, 0x28, 0x44, 0xcc, 0x9d, 0x30, 0x8d, 0x7f, 0x49, 0xb1, 0xd2, 0x21, 0xa8, 0xac, 0x35, 0x1c, 0xdb, 0x06, 0xc8, 0x33, 0xb5, 0xf8, 0xd4, 0x5b, 0x0d, 0xb9, 0x0a, 0xe3, 0x36, 0x04, 0xaf, 0x56, 0xb5, 0x1f, 0x21, 0xbc, 0x3f, 0x1a, 0x3b, 0x37, 0xf5, 0x0e, 0xdc, 0x04, 0xfa, 0x40, 0xa3, 0x5f, 0xae, 0xe8, 0xe9, 0xfd, 0x63, 0xc8, 0x7f, 0x01, 0xd7, 0x2e, 0xcc, 0x17, 0xb2, 0x13, 0xb7, 0x2d, 0xba, 0xdc, 0x4e, 0xb0, 0x60, 0xad, 0x01, 0xe1, 0x23, 0xb1, 0x26, 0x65, 0x6c, 0x46, 0xdd, 0xc4, 0xd6, 0xcf, 0x64, 0x13, 0x33, 0x46, 0xce, 0x12, 0xef, 0xf0, 0x38, 0x56, 0x55, 0x15, 0xc8, 0x23, 0x54, 0x10, 0xec, 0x7f, 0xd2, 0x37, 0xdb, 0xd2, 0x7a, 0x32, 0xdb, 0x2a, 0xe4, 0x43, 0x27, 0xdf, 0xcb, 0x17, 0xcb, 0x47, 0xf8, 0xfe, 0x43, 0xbc, 0x18, 0xf1, 0x26, 0x6d, 0xf2, 0xc1, 0xa2, 0x25, 0xe7, 0xa7, 0xf5, 0x34, 0x76, 0x49, 0xc0, 0xdf, 0xbf, 0xc1, 0xe1, 0x03, 0x2b, 0x59, 0x03, 0xb5, 0xeb, 0xac, 0xa1, 0xd5, 0xdf, 0x08, 0xac, 0x0a, 0x7f, 0x0c, 0xd7, 0xd3, 0xfb, 0x72, 0x68, 0x39, 0x3a, 0x3c, 0xa6, 0x2f, 0x49, 0x65, 0x53, 0x15, 0x1f, 0x68, 0x58, 0x4e, 0x5a, 0x5d, 0x38, 0x38, 0xbd, 0xc2, 0x24, 0xfa, 0x37, 0x33, 0x54, 0x2c, 0x02, 0xf5, 0x35, 0x2b, 0x1a, 0x1c, 0xe0, 0xee, 0xd4, 0x49, 0xdb, 0x61, 0x1c, 0x2b, 0xa0, 0xb8, 0x2c, 0x7f, 0x1f, 0x7f, 0xdc, 0x0a, 0xea, 0xbd, 0x53, 0xc0, 0x18, 0x0b, 0xfb, 0x20, 0x14, 0x21, 0xff, 0x1a, 0xeb, 0xdc, 0x6d, 0x71, 0x02, 0x75, 0x77, 0x4d, 0x95, 0xf2, 0xd8, 0xbc, 0x67, 0x60, 0x41, 0x10, 0xd7, 0x55, 0xbe, 0xf3, 0x6a, 0xfa, 0xd5, 0x0d, 0x21, 0x76, 0x16, 0x05, 0xb5, 0xee, 0x13, 0x2f, 0x61, 0xe1, 0x7f, 0x05, 0x27, 0x66, 0xb5, 0xc2, 0x57, 0xe7, 0x02, 0xfd, 0x55, 0x00, 0x32, 0x3f, 0xe8, 0xf7, 0x6f, 0x03, 0xb0, 0xf9, 0x5b, 0xf8, 0x5c, 0x2b, 0xd2, 0xd4, 0xd7, 0x2c, 0x2e, 0xd4, 0xe9, 0x1d, 0x0d, 0x1d, 0x11, 0xd0, 0x13, 0xdb, 0x13, 0x3e, 0xcf, 0x7f, 0xd5, 0x06, 0x15, 0xec, 0xf8, 0x46, 0x2b, 0x34, 0xe5, 0x51, 0xda, 0xd1, 0x2f, 0xd8, 0xd6, 0x0c, 0x13, 0x99, 0x12, 0x5a, 0x07, 0x20, 0x40, 0x28, 0x55, 0x9f, 0xe1, 0xb5, 0xf3, 0x50, 0x55, 0x03, 0x06, 0x1b, 0x16, 0x3a, 0xdd, 0x01, 0x22, 0x42, 0xe2, 0x4f, 0x44, 0xe4, 0xf1, 0xe1, 0xfc, 0x24, 0xf7, 0xbd, 0xec, 0x7f, 0xdd, 0x27, 0xf4, 0x65, 0x46, 0x12, 0x0e, 0x30, 0xc9, 0x56, 0xf6, 0x4e, 0xe1, 0x17, 0x36, 0x12, 0xfd, 0x08, 0xb6, 0xa0, 0x31, 0x0d, 0xe5, 0x17, 0x40, 0xf1, 0x6c, 0xcf, 0x44, 0x63, 0xdf, 0xb2, 0x05, 0xc6, 0x1a, 0xc4, 0xdb, 0x5c, 0x15, 0xe4, 0x00, 0xbf, 0x6a, 0xe3, 0x28, 0x5c, 0xcd, 0xe6, 0xfe, 0xc8, 0xcc, 0xd4, 0xf4, 0x6b, 0xe9, 0xe8, 0x4b, 0xef, 0x7f, 0x11, 0x66, 0x08, 0x1b, 0x1d, 0xcb, 0xbd, 0x28, 0xbc, 0x0c, 0x59, 0x39, 0x1c, 0x44, 0xd4, 0x17, 0xee, 0x04, 0x25, 0xf5, 0xc1, 0x02, 0x9b, 0xb1, 0xdd, 0x3a, 0x5e, 0x1d, 0xda, 0x00, 0xcf, 0x52, 0xc6, 0x5a, 0x5e, 0x37, 0xbd, 0x7e, 0xa8, 0x22, 0xa3, 0x10, 0xff, 0x18, 0x3e, 0x18, 0xd4, 0x5d, 0x03, 0x7f, 0x54, 0x32, 0xb4, 0x18, 0xba, 0xea, 0xab, 0xf8, 0x7a, 0xba, 0x7f, 0x19, 0x04, 0xff, 0x23, 0x24, 0x11, 0xc7, 0xb9, 0xe0, 0xa8, 0x92, 0x32, 0xcc, 0x6d, 0x54, 0x2d, 0xbd, 0xd3, 0xf7, 0xa9, 0x29, 0x4e, 0xbe, 0xc1, 0x45, 0xe0, 0xa9, 0xc8, 0x59, 0x6c, 0x13, 0x68, 0x28, 0x38, 0x59, 0xb6, 0x64, 0x08, 0xda, 0xef, 0x58, 0x71, 0x21, 0x32, 0x4e, 0xe6, 0xed, 0xdd, 0x4c, 0xc9, 0xb6, 0x37, 0xca, 0xad, 0xbe, 0x7f, 0x35, 0x6b, 0xd6, 0xac, 0x39, 0xc5, 0x2b, 0xa6, 0x14, 0x35, 0x56, 0x18, 0x84, 0x52, 0xd2, 0x1b, 0xf1, 0xec, 0x5a, 0x48, 0x1e, 0x9f, 0x26, 0x21, 0xa1, 0x1e, 0x6e, 0xc8, 0xf0, 0xbd, 0xed, 0x70, 0xd7, 0xe3, 0xad, 0x61, 0xa7, 0x1e, 0xaa, 0xe1, 0xed, 0xe4, 0x97, 0xce, 0xa3, 0x81, 0x34, 0xd8, 0x18, 0xe9, 0x10, 0x41, 0xed, 0xd9, 0x86, 0xc6, 0xc2, 0x46, 0xaf, 0x85, 0xf3, 0x4d, 0xe8, 0xdd, 0x53, 0x58, 0x83, 0xff, 0xdc, 0x0b, 0xf8, 0xdb, 0x1d, 0x5b, 0x1c, 0xcd, 0xb1, 0x44, 0x47, 0x45, 0xcf, 0xd0, 0xc0, 0xec, 0x25, 0xb1, 0x2b, 0x14, 0xd6, 0x2a, 0x29, 0xfe, 0xad, 0x7f, 0x29, 0xe7, 0x0c, 0x95, 0x0d, 0x97, 0xd0, 0x9e, 0xfd, 0xe5, 0x42, 0xb7, 0xd0, 0x23, 0x4e, 0x76, 0xf1, 0xbd, 0x30, 0xdd, 0xc8, 0x13, 0x38, 0x33, 0xea, 0x19, 0x1d, 0x02, 0x30, 0x0b, 0xce, 0x64, 0xe2, 0x3a, 0x16, 0xa8, 0xa6, 0xc6, 0x13, 0x44, 0x4b, 0xce, 0xfa, 0xf9, 0xd1, 0xe2, 0x1f, 0x4d, 0x43, 0xc7, 0x27, 0xd3, 0x19, 0x24, 0xef, 0xdc, 0x02, 0x49, 0x05, 0x24, 0x0d, 0xcc, 0x2a, 0x58, 0xc3, 0x14, 0x2a, 0x09, 0xf5, 0xab, 0x64, 0x49, 0x03, 0xf1, 0xc2, 0xac, 0xe6, 0x40, 0x3b, 0x7f, 0x02, 0xd3, 0x32, 0xe0, 0x04, 0x44, 0xf9, 0x12, 0x11, 0x59, 0x6d, 0x69, 0xfe, 0x2a, 0x98, 0xc8, 0x57, 0xbf, 0xf1, 0x42, 0x3d, 0xd7, 0x3a, 0xc0, 0x12, 0x8b, 0x40, 0x6d, 0x59, 0x57, 0xc9, 0x07, 0x61, 0xd6, 0x05, 0xde, 0x10, 0x03, 0x03, 0xa9, 0xba, 0xfb, 0x51, 0x7f, 0x14, 0xfb, 0x0f, 0x3b, 0x00, 0x67, 0xf0, 0x8b, 0xaa, 0xf4, 0x26, 0x23, 0x0c, 0x6d, 0x1a, 0xd9, 0x62, 0xe2, 0xf5, 0x6a, 0xfa, 0xc4, 0xc7, 0xe9, 0x45, 0xc9, 0xd2, 0x78, 0x65, 0xcf, 0x2f, 0xa5, 0x68, 0x23, 0x2a, 0x26, 0x09, 0xc3, 0xf3, 0x8c, 0xda, 0xae, 0xd6, 0x72, 0xe8, 0x74, 0x53, 0xd4, 0x4f, 0xf9, 0x6c, 0x76, 0x0d, 0x81, 0xc3, 0xeb, 0x0a, 0x5c, 0xc8, 0xb8, 0xea, 0x1c, 0x06, 0x27, 0x54, 0x7a, 0x27, 0x04, 0x70, 0x77, 0xd8, 0xf6, 0x39, 0x44, 0x54, 0xfa, 0xdd, 0x1a, 0xa6, 0xfc, 0x3d, 0x1d, 0x15, 0x03, 0xfb, 0x5d, 0xb5, 0x53, 0x16, 0x56, 0x4b, 0xe6, 0xfb, 0x23, 0xb7, 0x22, 0x67, 0xf6, 0x91, 0xe0, 0x3a, 0x7f, 0x5e, 0x53, 0xe1, 0xee, 0xe3, 0xb2, 0xcd, 0xa1, 0x09, 0xec, 0xd4, 0x5a, 0xc3, 0xf9, 0x4d, 0xe7, 0x06, 0x2b, 0x7d, 0x7f, 0x49, 0x9c, 0x40, 0xf4, 0x2b, 0x4f, 0xe4, 0x03, 0x63, 0x18, 0x4e, 0x4f, 0xa7, 0xbb, 0xe2, 0x7b, 0x5f, 0x49, 0xe2, 0x68, 0x4e, 0x03, 0xbe, 0x06, 0x4d, 0xcc, 0x3d, 0xf8, 0x56, 0x7f, 0x6d, 0xd1, 0x10, 0x52, 0x5a, 0xbc, 0x0e, 0x73, 0x0d, 0x71, 0xef, 0x37, 0x16, 0x11, 0x1b, 0xdf, 0x7f, 0x74, 0x38, 0x16, 0xe7, 0xcf, 0xcd, 0xfc, 0xd3, 0x4b, 0x30, 0xa2, 0x11, 0x2f, 0x4b, 0x41, 0xd5, 0xe1, 0x3b, 0xf4, 0x2d, 0x13, 0x4e, 0xe0, 0x42, 0x57, 0x93, 0x3d, 0x73, 0xfa, 0xd7, 0x69, 0x19, 0x0e, 0x3b, 0xed, 0x39, 0xd3, 0xc1, 0xef, 0x3d, 0x73, 0x20, 0x96, 0x2a, 0x54, 0xbf, 0xfc, 0xd3, 0x07, 0xf7, 0x0b, 0x0a, 0x4e, 0xd5, 0x0f, 0xf4, 0x49, 0xcf, 0x12, 0x1f, 0x73, 0xd0, 0x51, 0x4b, 0xfa, 0x60, 0xdf, 0xfd, 0xfa, 0x15, 0x06, 0x18, 0x46, 0xe8, 0x18, 0xe5, 0x7f, 0xef, 0xcf, 0xf5, 0x9c, 0x14, 0xe4, 0x3a, 0x7f, 0x45, 0xd9, 0x3c, 0xe2, 0x21, 0x02, 0xbc, 0x9e, 0xef, 0x3c, 0x26, 0x8b, 0x5e, 0x61, 0x05, 0x34, 0x54, 0xdd, 0x14, 0x21, 0x57, 0x04, 0xfe, 0x91, 0x30, 0x95, 0xf8, 0x3c, 0xfb, 0x20, 0x5e, 0x75, 0x2e, 0xe3, 0x5c, 0xff, 0x2d, 0x2f, 0xb6, 0xe2, 0xf9, 0xf5, 0x94, 0xd6, 0xb1, 0xd4, 0xb5, 0x65, 0xec, 0xcd, 0x19, 0x08, 0x14, 0xfc, 0x23, 0x03, 0xa4, 0x81, 0xb4, 0x96, 0x4c, 0x5e, 0xc5, 0x52, 0xc3, 0x05, 0x6b, 0xba, 0x6b, 0x07, 0x38, 0x9b, 0x00, 0xbc, 0xaf, 0x0a, 0xf4, 0x46, 0xcf, 0x05, 0x53, 0xb2, 0x6f, 0x3c, 0x10, 0x0d, 0x50, 0xbe, 0xe6, 0x67, 0x34, 0xdc, 0x0a, 0xf5, 0xe6, 0xdd, 0xee, 0xf0, 0xee, 0x51, 0xbc, 0xcf, 0x7b, 0x7f, 0xcf, 0x70, 0x58, 0x3c, 0xeb, 0xe7, 0xff, 0x05, 0xd3, 0x1f, 0x6d, 0xe7, 0x09, 0xee, 0x38, 0x13, 0xfc, 0x7c, 0x09, 0x16, 0x4e, 0xd8, 0xe1, 0x3c, 0xdc, 0x79, 0xf5, 0xed, 0x38, 0x2f, 0x47, 0x70, 0xd6, 0x29, 0x13, 0x31, 0xf0, 0xe4, 0x3c, 0xdb, 0x13, 0x1e, 0x31, 0x0a, 0xfe, 0xef, 0x24, 0x23, 0xd6, 0x78, 0xec, 0x14, 0x76, 0x19, 0x67, 0x4f, 0xd3, 0xde, 0x19, 0xf9, 0x0c, 0x96, 0x7f, 0x00, 0xca, 0xdc, 0x2a, 0x3d, 0xe4, 0x34, 0x42, 0xd9, 0x09, 0x0d, 0x57, 0x36, 0xb3, 0xdc, 0x59, 0x3b, 0x20, 0x8e, 0xf1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa6, 0xf1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbe, 0xf1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xd6, 0xf1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xfe, 0x67, 0x17, 0xbe, 0x74, 0x3b, 0x2b, 0x3e, 0x4b, 0x27, 0xf1, 0xbd, 0xc1, 0xaf, 0x93, 0xbd, 0x21, 0x26, 0x0f, 0xbd, 0x73, 0x69, 0xff, 0x3d, 0x2d, 0x58, 0x45, 0xbd, 0xe9, 0x07, 0xd8, 0x3d, 0x43, 0x5f, 0x95, 0x3d, 0xd8, 0x92, 0x4f, 0xbc, 0x17, 0x05, 0x8c, 0xbd, 0x6a, 0x0c, 0x24, 0x3c, 0x6d, 0x50, 0x1a, 0xbd, 0x3f, 0x5d, 0x05, 0xbe, 0xf8, 0xfb, 0x78, 0xbc, 0x3b, 0x5f, 0xc0, 0x3d, 0x22, 0xf2, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x4e, 0xef, 0xef, 0xbc, 0x4f, 0x7b, 0x10, 0xbd, 0xc5, 0xdb, 0x0c, 0x3d, 0xe4, 0x7e, 0x95, 0x3d, 0xc7, 0xc5, 0x89, 0xba, 0x8f, 0xb8, 0x1d, 0xbd, 0x67, 0xec, 0xbe, 0xbc, 0x4c, 0x35, 0x2e, 0x3b, 0xd1, 0x2a, 0x90, 0xbc, 0x30, 0xa3, 0x03, 0xbc, 0x11, 0x36, 0xd2, 0xbd, 0x7e, 0x89, 0x02, 0x3d, 0x2d, 0x4c, 0x52, 0xbd, 0x02, 0xc6, 0xbd, 0x3d, 0xa3, 0x29, 0xee, 0xbd, 0xc4, 0xd0, 0x37, 0x3c, 0xd9, 0x2f, 0x93, 0x3d, 0x9c, 0xcb, 0x3a, 0x3c, 0xcf, 0x13, 0x4e, 0x3d, 0xa3, 0x8a, 0x9f, 0xbc, 0x6b, 0xef, 0x14, 0xbc, 0x3d, 0x65, 0xf7, 0x3c, 0x73, 0xc8, 0xfa, 0x3c, 0x20, 0xbb, 0xe3, 0x37, 0x13, 0x97, 0x0c, 0xbe, 0x4c, 0x0e, 0x2c, 0x3d, 0xeb, 0x85, 0x1c, 0x3d, 0x6d, 0xfd, 0x06, 0xbe, 0xb1, 0x09, 0x21, 0x3d, 0x99, 0xf5, 0xc8, 0x39, 0x7d, 0xfc, 0xd7, 0xbd, 0x52, 0xba, 0x58, 0xbd, 0xae, 0xf2, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0xe2, 0x16, 0x21, 0xbe, 0x8e, 0xd6, 0x11, 0xbe, 0x5e, 0xbc, 0x8b, 0x3e, 0xad, 0xf8, 0xea, 0xbd, 0xe3, 0x00, 0xf3, 0x3d, 0xeb, 0x4a, 0xb4, 0x3e, 0x5b, 0xe9, 0xa8, 0xbe, 0xe3, 0xe5, 0xd0, 0xbd, 0x49, 0x82, 0x4f, 0xbe, 0x39, 0xab, 0x6f, 0x3e, 0xe9, 0x88, 0xa4, 0xbe, 0xf7, 0x0d, 0x09, 0xbe, 0xe9, 0x34, 0x11, 0xbe, 0x03, 0x39, 0xc9, 0xbd, 0x34, 0x30, 0x01, 0xbf, 0xed, 0x01, 0x93, 0xbd, 0x4f, 0x93, 0x8b, 0xbe, 0xa7, 0x1c, 0x60, 0xbe, 0x65, 0x45, 0x64, 0xbe, 0xab, 0xd3, 0xab, 0xbb, 0x7a, 0xad, 0xc6, 0x3e, 0xa0, 0xd5, 0x0a, 0x3e, 0xa4, 0xab, 0x9b, 0x3e, 0x00, 0xc7, 0x26, 0xbe, 0xc6, 0x1a, 0x9b, 0xbd, 0x23, 0x62, 0x1d, 0x3e, 0x6a, 0x0a, 0x11, 0x3e, 0x48, 0x39, 0x24, 0xbe, 0x94, 0xa0, 0xef, 0x3d, 0x97, 0x20, 0x35, 0xbe, 0x24, 0x31, 0xd0, 0xbe, 0x19, 0xc7, 0xaa, 0x3e, 0xd9, 0x61, 0x66, 0xbe, 0x55, 0xff, 0x64, 0xbd, 0x5f, 0xbe, 0x68, 0xbe, 0x23, 0x99, 0xad, 0x3e, 0x6a, 0x63, 0xd2, 0x3c, 0x1a, 0x8c, 0xad, 0x3e, 0x11, 0x20, 0xb7, 0xbe, 0xb6, 0x7a, 0x5b, 0xbd, 0x5b, 0x81, 0xbb, 0x3e, 0xf0, 0xab, 0x9b, 0x3e, 0xa1, 0x24, 0x98, 0xbe, 0x98, 0x96, 0x92, 0xbd, 0x98, 0x2a, 0x4e, 0x3d, 0x12, 0xe1, 0x70, 0x3e, 0xdb, 0x40, 0x74, 0xbe, 0xfb, 0x8b, 0xa4, 0x3e, 0x65, 0xbb, 0xa2, 0xbd, 0xc1, 0xff, 0x16, 0x3d, 0x2b, 0xc5, 0x55, 0x3e, 0x19, 0xe4, 0x18, 0xbe, 0x8d, 0xeb, 0x01, 0xbe, 0x71, 0xfe, 0xad, 0xbb, 0x41, 0x3a, 0xfb, 0x3d, 0xdb, 0xb1, 0x2e, 0xbd, 0x8c, 0x44, 0xcc, 0xbe, 0x98, 0xd0, 0x45, 0xbd, 0xf6, 0x3d, 0x45, 0xbe, 0x27, 0xd6, 0x1e, 0xbe, 0x32, 0xe3, 0x84, 0xbe, 0x32, 0x52, 0xb7, 0xbd, 0x62, 0xd7, 0xd8, 0xbd, 0xcf, 0x2a, 0x4a, 0xbe, 0xba, 0xe7, 0x0d, 0xbe, 0x85, 0x30, 0x49, 0xbd, 0xa3, 0x95, 0x3f, 0x3e, 0xde, 0x41, 0xbe, 0x3e, 0x6b, 0x87, 0x6a, 0xbe, 0xb1, 0xd4, 0xdc, 0xbd, 0xca, 0x28, 0x64, 0x3e, 0xd7, 0x0f, 0x99, 0xbd, 0x30, 0x92, 0x3d, 0x3e, 0xe6, 0xd9, 0x3b, 0x3e, 0xf3, 0x62, 0x21, 0x3d, 0xcf, 0x8a, 0xc4, 0x3e, 0xc3, 0x6c, 0x53, 0x3d, 0x2e, 0x5d, 0x88, 0x3e, 0x71, 0x25, 0x7f, 0x3e, 0x17, 0x00, 0xab, 0xbe, 0x70, 0x58, 0x00, 0x3e, 0xd9, 0x8e, 0x54, 0x3e, 0x11, 0x99, 0x8b, 0x3c, 0x65, 0x45, 0x9a, 0x3e, 0xe2, 0xaf, 0x3f, 0xbe, 0x3a, 0x24, 0x51, 0xbe, 0x1d, 0x83, 0x74, 0x3d, 0x86, 0x99, 0x5e, 0x3e, 0x9e, 0x23, 0x39, 0x3e, 0x3f, 0xc4, 0x94, 0x3c, 0xd2, 0x48, 0x71, 0x3e, 0xb0, 0x22, 0x9f, 0x3e, 0x1d, 0xfd, 0x28, 0xbd, 0xd2, 0x8b, 0x1e, 0x3e, 0x8f, 0xa8, 0x3a, 0x3e, 0xfc, 0xc0, 0xc7, 0xbc, 0x3f, 0x05, 0xbb, 0xbd, 0x4c, 0xba, 0x2e, 0x3e, 0x4e, 0xb2, 0xe8, 0x3a, 0xcf, 0x97, 0x8a, 0xbd, 0x4a, 0xcd, 0x64, 0xbe, 0x79, 0x86, 0x59, 0x3e, 0x14, 0xa9, 0x85, 0x3e, 0x08, 0x90, 0xe4, 0x3c, 0x5f, 0xaf, 0x18, 0x3d, 0xfc, 0xc1, 0xdc, 0xbe, 0xb5, 0xf1, 0x35, 0xbe, 0x09, 0xd8, 0x04, 0x3e, 0x1a, 0x22, 0x30, 0x3b, 0x69, 0x9c, 0x8f, 0xbe, 0xdb, 0x19, 0x84, 0x3e, 0x85, 0x30, 0xd7, 0xbd, 0xb9, 0x42, 0xda, 0x3d, 0x1e, 0x35, 0xc7, 0x3e, 0x7d, 0x6e, 0x20, 0x3e, 0xf6, 0x20, 0x6a, 0x3e, 0xa6, 0x52, 0xaa, 0xbe, 0x4a, 0x79, 0x8f, 0xbe, 0xfb, 0xb9, 0x9d, 0xbd, 0x57, 0xd9, 0x9c, 0x3e, 0x63, 0xc0, 0x80, 0x3e, 0x64, 0xb2, 0x9f, 0xbe, 0xbb, 0x6f, 0x97, 0x3e, 0x43, 0x82, 0x6d, 0x3e, 0xc2, 0x9d, 0xde, 0x3d, 0x12, 0x01, 0x4d, 0x3e, 0x84, 0x55, 0x10, 0x3e, 0x91, 0x7e, 0x11, 0x3d, 0x32, 0x92, 0x0d, 0x3e, 0x9b, 0x7a, 0xcc, 0x3e, 0xc5, 0x78, 0x63, 0x3e, 0x19, 0xe5, 0xb9, 0x3d, 0x03, 0x47, 0x6f, 0x3e, 0xf6, 0xe8, 0xb0, 0xbd, 0x36, 0x90, 0x70, 0x3c, 0x6e, 0x64, 0xcb, 0x3c, 0x89, 0x3a, 0x79, 0x3e, 0x54, 0x1c, 0xc3, 0xbd, 0x81, 0x94, 0x9b, 0x3e, 0x7a, 0x34, 0x0d, 0xbd, 0x6b, 0x29, 0x23, 0xbe, 0xfb, 0x4d, 0x5e, 0x3d, 0xff, 0x1f, 0x8a, 0x3e, 0x38, 0xce, 0xb1, 0xbd, 0x68, 0xf3, 0x22, 0x3e, 0xb8, 0x80, 0xdc, 0xbd, 0x3b, 0x67, 0x9a, 0x3d, 0x38, 0x5b, 0x23, 0x3c, 0x69, 0xa1, 0xac, 0x3e, 0x9e, 0xe8, 0x7e, 0xbe, 0xfa, 0xd5, 0xc5, 0xbd, 0x2e, 0x48, 0x1f, 0x3e, 0x58, 0x98, 0x6f, 0x3e, 0x26, 0x89, 0x9a, 0xbd, 0x41, 0x1c, 0xa0, 0x3e, 0x94, 0x9e, 0x05, 0xbe, 0x44, 0x35, 0x97, 0xbd, 0x02, 0x01, 0x7f, 0x3e, 0x2f, 0x0b, 0x95, 0x3e, 0xc6, 0xa6, 0x02, 0x3d, 0x62, 0x90, 0x8f, 0xbe, 0x30, 0x6f, 0xc0, 0x3e, 0x76, 0x89, 0xb4, 0xbe, 0xa5, 0x1e, 0xcc, 0xbe, 0x1c, 0xc6, 0x9b, 0x3e, 0xff, 0x3a, 0x19, 0x3e, 0x85, 0x0c, 0x0b, 0x3e, 0x73, 0xca, 0x39, 0xbd, 0x41, 0x27, 0x16, 0xbe, 0xd9, 0x1c, 0x9a, 0xbe, 0xd5, 0x90, 0x1f, 0x3d, 0xf3, 0x7e, 0xd4, 0x3e, 0x74, 0x81, 0xac, 0xbe, 0x97, 0xa5, 0x10, 0x3d, 0x8e, 0x58, 0x3e, 0x3d, 0x31, 0x51, 0x1e, 0xbe, 0x8c, 0x6b, 0xa0, 0xbe, 0x99, 0xa9, 0xf1, 0x3e, 0xf7, 0x26, 0xe0, 0xbd, 0xd2, 0x7f, 0x39, 0xbe, 0xf7, 0x04, 0x50, 0xbe, 0x01, 0x67, 0x23, 0xbe, 0x8f, 0x47, 0x29, 0x3e, 0x6a, 0xab, 0x4c, 0xbe, 0x9c, 0xca, 0x0e, 0x3e, 0x1c, 0x94, 0xc1, 0x3e, 0xd2, 0x68, 0xd4, 0xbe, 0x59, 0xfa, 0xb4, 0xbd, 0xa0, 0xd9, 0x28, 0xbd, 0xce, 0x82, 0x6e, 0x3d, 0xe8, 0x52, 0x84, 0x3a, 0xf9, 0x8e, 0x88, 0x3e, 0xda, 0x16, 0xb4, 0xbe, 0x03, 0x1b, 0xb1, 0xbd, 0x14, 0xb7, 0xd8, 0xbd, 0x02, 0x22, 0x82, 0xbd, 0xc3, 0xe1, 0x09, 0x3d, 0x3b, 0xdb, 0x58, 0xbe, 0xb0, 0xc2, 0x3d, 0x3e, 0x1e, 0x33, 0x66, 0x3e, 0x82, 0xad, 0xc1, 0xbe, 0x29, 0xc0, 0x8f, 0x3e, 0x66, 0x5e, 0x3a, 0xbe, 0x14, 0x0d, 0x69, 0xbe, 0x1e, 0xbf, 0xec, 0x3d, 0xa7, 0xf7, 0x70, 0x3e, 0xba, 0x8b, 0xab, 0xbe, 0xec, 0x8f, 0xf1, 0x3e, 0xa8, 0x4a, 0x42, 0x3e, 0xe2, 0xd0, 0x69, 0x3e, 0xc5, 0xa5, 0x7a, 0x3e, 0xde, 0x0b, 0x92, 0xbe, 0x2d, 0x6b, 0x7e, 0xbd, 0xf9, 0xc9, 0xf8, 0x3e, 0xb1, 0x52, 0xf0, 0xbd, 0xf1, 0x08, 0x24, 0x3d, 0xc3, 0x1b, 0x1b, 0xbe, 0x67, 0x41, 0x7f, 0xbd, 0xdc, 0x36, 0x00, 0xbe, 0xfa, 0x06, 0xf1, 0xbe, 0xea, 0x86, 0x81, 0x3d, 0x1b, 0x78, 0x84, 0xbe, 0x2d, 0xb5, 0xa2, 0x3e, 0xd1, 0xff, 0x91, 0x3c, 0x46, 0xdb, 0x9c, 0xbe, 0x61, 0x6e, 0x23, 0xbe, 0x7e, 0x48, 0x38, 0xbd, 0xf0, 0xd7, 0x27, 0xbc, 0xf9, 0xed, 0x62, 0x3e, 0xd6, 0xe0, 0xf8, 0x3d, 0x7d, 0xa9, 0xab, 0xbd, 0x6e, 0x0c, 0xae, 0xbe, 0x86, 0x10, 0xf9, 0x3c, 0x21, 0xe9, 0x81, 0x3e, 0x80, 0x9c, 0x56, 0xbe, 0xf6, 0x2f, 0xba, 0x3e, 0x81, 0x0c, 0x9c, 0x3e, 0xa6, 0x99, 0xe6, 0xbb, 0x59, 0x4b, 0x75, 0xbe, 0xe2, 0x0d, 0x25, 0x3e, 0x50, 0xcd, 0x18, 0x3c, 0x70, 0xf5, 0x68, 0x3e, 0xca, 0x5f, 0xa7, 0xbe, 0x44, 0x70, 0x5b, 0xbe, 0xfc, 0xb9, 0xeb, 0x3c, 0x1b, 0xf9, 0x24, 0x3e, 0x75, 0xa4, 0x36, 0x3e, 0x96, 0xba, 0x46, 0xbe, 0x6d, 0x0e, 0x9d, 0xbe, 0xb0, 0xa5, 0xc9, 0x3e, 0xd7, 0x8f, 0x00, 0xbe, 0xf6, 0xe7, 0xc0, 0x3e, 0xa4, 0x37, 0x50, 0xbe, 0x08, 0xcb, 0x9a, 0xbd, 0xa7, 0x6f, 0xe8, 0xbd, 0x91, 0x5e, 0x93, 0xbe, 0x68, 0xe2, 0x89, 0xbe, 0x17, 0x9a, 0x48, 0xbd, 0x34, 0xe5, 0x12, 0xbd, 0xb3, 0xd0, 0x2a, 0x3e, 0x20, 0x4f, 0x8f, 0xbe, 0x21, 0x06, 0xb5, 0xbc, 0x7f, 0xab, 0x8e, 0x3e, 0x60, 0x4e, 0x50, 0x3d, 0xe2, 0x51, 0xd2, 0xbe, 0xe6, 0xb9, 0xa1, 0x3c, 0xa8, 0xea, 0x65, 0xbd, 0x7f, 0x71, 0x91, 0x3d, 0x5f, 0xb6, 0xdd, 0x3e, 0x1b, 0x45, 0xf9, 0x3d, 0x20, 0x06, 0xdb, 0xbd, 0x69, 0x62, 0x9a, 0x3e, 0x82, 0x71, 0x99, 0xbe, 0x4d, 0xe0, 0x4f, 0xbe, 0x13, 0x04, 0x3a, 0x3d, 0xb3, 0x42, 0x95, 0xbd, 0x7f, 0x85, 0x01, 0xbe, 0x8e, 0xed, 0x72, 0x3e, 0xe8, 0xa7, 0x64, 0xbe, 0x65, 0x84, 0x36, 0xbe, 0xae, 0x4e, 0x9e, 0xbe, 0xf0, 0x60, 0xb3, 0xbe, 0x48, 0x23, 0x68, 0x3e, 0xb9, 0x07, 0x57, 0x3e, 0xea, 0x86, 0x7e, 0xbe, 0x2f, 0x4e, 0xf4, 0xbb, 0x41, 0x5a, 0x24, 0x3d, 0x94, 0x45, 0x3a, 0xbe, 0x3a, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x90, 0xb3, 0xa4, 0x3e, 0xe2, 0xce, 0xa0, 0xbe, 0xe0, 0x9b, 0x3e, 0xbe, 0x5d, 0xe9, 0x27, 0xbf, 0x65, 0x36, 0x3b, 0xbe, 0xbe, 0x6d, 0xce, 0x3e, 0xc7, 0xbb, 0xbc, 0x3e, 0x54, 0xae, 0x11, 0xbf, 0x59, 0x66, 0x73, 0xbe, 0x15, 0x28, 0xd1, 0x3e, 0xf5, 0x8f, 0x6d, 0x3e, 0xb0, 0xe7, 0x7b, 0x3e, 0x5c, 0xb5, 0x30, 0xbe, 0x33, 0xea, 0x94, 0xbe, 0x68, 0xfd, 0xe0, 0x3e, 0x4f, 0x20, 0x1f, 0xbf, 0x86, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x2c, 0x17, 0x8d, 0xbe, 0x80, 0xb1, 0x4d, 0xbe, 0x62, 0x48, 0xef, 0x3e, 0xa1, 0x59, 0x03, 0x3f, 0xec, 0xb6, 0xb0, 0xbe, 0x53, 0x37, 0x0e, 0x3e, 0x7a, 0x0a, 0xa6, 0xbc, 0x25, 0x92, 0x28, 0xbe, 0x35, 0x06, 0x96, 0x3e, 0x37, 0x52, 0x0f, 0xbc, 0x5b, 0x6e, 0x6d, 0xbd, 0xd0, 0x8f, 0xa8, 0x3d, 0xec, 0xea, 0x36, 0x3d, 0x3a, 0x68, 0x62, 0x3e, 0x9f, 0x4c, 0x0b, 0x3e, 0x5d, 0x13, 0xab, 0xbe, 0x28, 0x48, 0x86, 0xbd, 0x37, 0x74, 0xb1, 0xbe, 0x49, 0x0d, 0x33, 0xbe, 0xa7, 0xfd, 0x8d, 0xbd, 0x28, 0xc5, 0xa0, 0x3d, 0xc5, 0x98, 0xcc, 0x3c, 0x66, 0xd2, 0x6f, 0xbd, 0x64, 0x72, 0xfe, 0xbd, 0x70, 0x83, 0xbe, 0x3e, 0x11, 0x55, 0xa3, 0xbd, 0x82, 0xf2, 0xb5, 0x3e, 0xf7, 0xc3, 0x36, 0x3e, 0x44, 0x44, 0xac, 0x3e, 0x03, 0x4b, 0x94, 0xbe, 0x40, 0x30, 0x1d, 0x3e, 0xf4, 0xcd, 0x53, 0x3d, 0x93, 0x7e, 0x5e, 0xbe, 0xb8, 0xe4, 0x6d, 0x3e, 0x0f, 0xb2, 0x1c, 0x3d, 0xda, 0xd6, 0xce, 0x3c, 0xab, 0xe6, 0xf0, 0x3e, 0x51, 0x48, 0xa3, 0x3e, 0x7e, 0x8c, 0x5e, 0x3e, 0x98, 0xf2, 0xa0, 0x3e, 0x42, 0x53, 0x48, 0xbe, 0xf0, 0xed, 0xb8, 0xbe, 0xe7, 0x30, 0x52, 0x3d, 0xf7, 0x27, 0x1b, 0xbe, 0x29, 0x61, 0x58, 0x3e, 0x92, 0x9a, 0xde, 0xbe, 0x8c, 0xf4, 0xdd, 0xbd, 0xc1, 0x4e, 0xe3, 0x3e, 0xa3, 0xcd, 0x94, 0x3e, 0xdb, 0xcc, 0x4a, 0x3e, 0x33, 0xaa, 0x4a, 0x3d, 0xf5, 0xfc, 0x76, 0x3e, 0xe6, 0xaf, 0xc8, 0xbd, 0xa8, 0x74, 0x51, 0x3e, 0xec, 0x3b, 0xd8, 0xba, 0x0b, 0xfb, 0x8c, 0x3e, 0xb3, 0x86, 0xd6, 0xbe, 0x7c, 0xa8, 0x6a, 0x3e, 0x7c, 0x78, 0xb2, 0xbd, 0xed, 0x4c, 0x16, 0x3e, 0x1c, 0x1d, 0x79, 0xbe, 0xcc, 0x80, 0xba, 0xbd, 0xf6, 0x28, 0xe9, 0xbe, 0x74, 0x90, 0xb1, 0xbe, 0xe8, 0xee, 0xe6, 0x3d, 0xd1, 0xdf, 0x85, 0x3e, 0xa1, 0x39, 0xb3, 0xbe, 0x20, 0x96, 0xfc, 0x3d, 0xe0, 0xd3, 0xa4, 0x3c, 0x24, 0xaa, 0xd4, 0xbd, 0x7e, 0xae, 0x86, 0xbe, 0x40, 0xda, 0xcc, 0x3c, 0x50, 0xa5, 0xc2, 0xbc, 0xcc, 0xe8, 0xe6, 0xbd, 0x6e, 0x4a, 0x8c, 0xbe, 0x1e, 0x01, 0x4d, 0x3e, 0xf8, 0x71, 0xac, 0xbe, 0x71, 0x0d, 0xab, 0x3e, 0x6d, 0xd7, 0x67, 0xbe, 0x22, 0x48, 0x92, 0xbe, 0x8d, 0xbb, 0x8f, 0x3e, 0x83, 0xdb, 0xa4, 0xbe, 0xa0, 0x81, 0xf9, 0x3d, 0x9c, 0x01, 0xa9, 0xbd, 0x22, 0xc8, 0xd6, 0xbd, 0x8f, 0xac, 0x2c, 0xbe, 0xac, 0x44, 0xa7, 0xbe, 0x70, 0x59, 0xbd, 0xbc, 0x18, 0x16, 0xad, 0xbd, 0xad, 0x7f, 0xa4, 0x3e, 0xec, 0x35, 0x77, 0xbe, 0x5f, 0x04, 0x8d, 0x3e, 0x69, 0xe6, 0x6b, 0xbe, 0x2c, 0x41, 0x55, 0xbe, 0xce, 0x91, 0x78, 0x3e, 0xe0, 0x53, 0x8b, 0xbd, 0x11, 0xd2, 0x97, 0xbe, 0xca, 0xea, 0x81, 0x3e, 0x9d, 0x4a, 0x8d, 0xbe, 0xb9, 0x70, 0xdf, 0xbe, 0x30, 0x17, 0xc6, 0x3e, 0xf1, 0x3c, 0x2e, 0x3e, 0x60, 0x8a, 0x11, 0x3e, 0xa8, 0x65, 0x5d, 0x3e, 0x87, 0xed, 0x33, 0x3e, 0xc6, 0x23, 0xa6, 0xbe, 0x8c, 0xa4, 0xba, 0xbe, 0xb2, 0x60, 0x1b, 0x3e, 0xce, 0xf3, 0x8f, 0xbd, 0xe0, 0xa0, 0x5e, 0xbe, 0x61, 0x2b, 0xf2, 0xbd, 0xb7, 0xc2, 0x8b, 0x3e, 0xc7, 0x5a, 0x5b, 0x3e, 0x83, 0x16, 0xdb, 0x3e, 0xf6, 0xc2, 0x49, 0x3b, 0x32, 0x63, 0xa8, 0x3d, 0x3b, 0x93, 0x42, 0x3e, 0xce, 0x6c, 0xc3, 0x3e, 0xc6, 0x7c, 0x06, 0xbe, 0x49, 0x88, 0x2f, 0x3e, 0x6c, 0x72, 0x61, 0xbe, 0x25, 0xf3, 0x12, 0x3e, 0x94, 0x4c, 0x12, 0x3e, 0x1b, 0x8c, 0xe2, 0xbe, 0x25, 0x99, 0x4b, 0x3e, 0x4c, 0x90, 0xbe, 0x3e, 0xf5, 0xc8, 0xca, 0xbe, 0x95, 0x04, 0xd4, 0xbd, 0x3c, 0xbf, 0xae, 0xbd, 0xe6, 0xc6, 0x1b, 0x3e, 0xd0, 0x5e, 0x93, 0x3e, 0xe8, 0xbf, 0x21, 0x3e, 0x7a, 0x68, 0x9c, 0x3d, 0x81, 0x34, 0x54, 0x3c, 0x45, 0x8b, 0xf1, 0x3d, 0x40, 0xc2, 0x15, 0x3d, 0xa7, 0x19, 0x94, 0x3e, 0xec, 0x6c, 0x0b, 0xbe, 0x94, 0x4c, 0x93, 0xbe, 0x59, 0x61, 0x10, 0xbe, 0x80, 0xfa, 0xa8, 0xbe, 0xfe, 0x66, 0x34, 0x3d, 0x79, 0xd7, 0x04, 0x3d, 0xe4, 0xb1, 0x13, 0xbe, 0x7a, 0x47, 0x6d, 0xbe, 0x07, 0x65, 0xc4, 0x3d, 0x4d, 0x0b, 0x04, 0xbe, 0x9c, 0x6f, 0x18, 0x3e, 0x99, 0xd5, 0x10, 0xbe, 0x40, 0x67, 0x88, 0xbe, 0xb0, 0x0a, 0x93, 0xbd, 0xae, 0x6a, 0xbf, 0xbc, 0x06, 0xfe, 0xac, 0x3d, 0xff, 0xf2, 0x8e, 0x3d, 0x69, 0xac, 0x9e, 0xbd, 0xd5, 0xe8, 0x40, 0xbe, 0x32, 0x03, 0xa1, 0xbe, 0x1d, 0x69, 0x8f, 0x3e, 0x4b, 0x51, 0x89, 0xbe, 0x66, 0x27, 0x2e, 0x3e, 0x9b, 0x0c, 0xdb, 0xbd, 0x19, 0x28, 0x54, 0xbe, 0xe5, 0xc7, 0xef, 0x3d, 0xa0, 0x9b, 0x57, 0x3e, 0x90, 0xe8, 0x35, 0xbe, 0x53, 0x90, 0x48, 0xbe, 0x34, 0x7b, 0x98, 0x3e, 0x92, 0x89, 0x77, 0xbe, 0xab, 0x35, 0x05, 0xbe, 0x89, 0x64, 0x87, 0x3e, 0x07, 0x15, 0xb6, 0x3e, 0x8a, 0x45, 0xe2, 0x3e, 0x4e, 0xc1, 0xcb, 0x3d, 0xc2, 0x5c, 0xe8, 0x3e, 0x70, 0xcd, 0xcc, 0x3e, 0x72, 0xc3, 0x66, 0xbe, 0x20, 0x64, 0x45, 0x3e, 0x32, 0xd0, 0x52, 0xbd, 0xad, 0x3e, 0x55, 0x3e, 0x00, 0x44, 0x9a, 0xbe, 0x5a, 0x68, 0xb5, 0xbe, 0x26, 0x50, 0xbb, 0xbe, 0x13, 0x78, 0x09, 0xbc, 0xac, 0x93, 0xba, 0xbe, 0xa4, 0x47, 0x15, 0xbe, 0x5c, 0xf4, 0x0c, 0x3c, 0x9e, 0x79, 0x68, 0x3e, 0xd8, 0xb6, 0xe1, 0x3d, 0x2a, 0x5e, 0xfb, 0x3d, 0x85, 0xbb, 0x6c, 0xbe, 0x23, 0xa4, 0xc1, 0x3d, 0x85, 0x5f, 0xbb, 0x3d, 0xb9, 0x9a, 0xa6, 0xbe, 0x60, 0x3b, 0x3e, 0x3e, 0x3f, 0x5c, 0x7d, 0xbd, 0x89, 0x0a, 0x8e, 0xbd, 0x3b, 0x22, 0xcf, 0xbe, 0xb9, 0x88, 0xbc, 0x3e, 0x06, 0x83, 0xca, 0x3e, 0xe0, 0xcc, 0x18, 0xbd, 0xe8, 0x03, 0xbb, 0xba, 0xf7, 0x9c, 0xe0, 0x3e, 0x42, 0xde, 0x4d, 0xbe, 0xb6, 0xa9, 0xf4, 0xbc, 0x5b, 0x37, 0xc1, 0x3e, 0x93, 0xd5, 0x8a, 0x3d, 0xb1, 0x9e, 0x01, 0x3f, 0xb3, 0x43, 0x15, 0xbe, 0x7f, 0x08, 0x97, 0xbe, 0x87, 0x94, 0x69, 0xbe, 0x74, 0x38, 0x71, 0xbd, 0x15, 0x9b, 0x8d, 0x3e, 0x02, 0x06, 0x04, 0x3d, 0xa8, 0x25, 0x3e, 0xbe, 0x8c, 0xa6, 0xb9, 0xbd, 0xdc, 0x49, 0x3e, 0x3e, 0xfa, 0xe0, 0xeb, 0x3e, 0x4b, 0x14, 0xda, 0x3e, 0x22, 0x5a, 0x54, 0xbe, 0x26, 0x35, 0xc5, 0x3e, 0x25, 0x5c, 0xaa, 0xbe, 0xb9, 0xc6, 0xee, 0x3d, 0x24, 0x0f, 0xc3, 0xbc, 0x22, 0xff, 0xda, 0x3e, 0xa7, 0x83, 0x88, 0x3c, 0xcc, 0xba, 0x7a, 0x3e, 0x04, 0x16, 0x20, 0x3e, 0x94, 0x57, 0x49, 0xbe, 0x20, 0x42, 0x39, 0x3d, 0x96, 0xf7, 0x19, 0x3e, 0xef, 0x85, 0x8e, 0xbe, 0x83, 0x17, 0x0e, 0xbd, 0x21, 0x04, 0xac, 0x3e, 0x77, 0x2c, 0x2e, 0x3e, 0xf2, 0x55, 0x2b, 0xbe, 0x64, 0xf4, 0x50, 0x3d, 0xfa, 0x88, 0x96, 0x3e, 0x7c, 0x9b, 0x57, 0x3e, 0x30, 0xfd, 0xef, 0xbe, 0x64, 0xef, 0x8f, 0x3e, 0x93, 0xe5, 0xcb, 0xbc, 0xc7, 0x90, 0xc8, 0x3e, 0x13, 0xc0, 0x9a, 0xbe, 0x6e, 0x71, 0x82, 0x3e, 0xd9, 0xe8, 0xfa, 0x3d, 0x63, 0xaf, 0x65, 0x3e, 0x53, 0xba, 0xa7, 0xbe, 0xd3, 0x29, 0xdf, 0x3e, 0xb1, 0xc4, 0x93, 0x3d, 0x08, 0x0a, 0xab, 0xbe, 0x68, 0x97, 0x8d, 0xbe, 0x1a, 0xe8, 0x1e, 0x3d, 0x2e, 0x07, 0x7e, 0x3e, 0x27, 0x32, 0x8d, 0x3e, 0x28, 0x1d, 0xf1, 0xbe, 0xf4, 0xbb, 0x99, 0x3e, 0xc8, 0xc5, 0xb6, 0xbd, 0x18, 0x22, 0xf5, 0xbd, 0x11, 0x4a, 0x6b, 0xbc, 0xb3, 0x4b, 0xc5, 0x3a, 0x4e, 0x08, 0xec, 0x3d, 0xf4, 0x04, 0x8f, 0xbe, 0x54, 0xa9, 0x0e, 0xbe, 0x1c, 0xda, 0x63, 0x3d, 0xd5, 0x07, 0x44, 0xbe, 0x5b, 0x39, 0xc1, 0xbe, 0xa0, 0xc3, 0x8b, 0xbe, 0x8c, 0x09, 0x16, 0xbc, 0x53, 0x85, 0xea, 0xbd, 0x17, 0x78, 0x69, 0x3e, 0x39, 0x1c, 0xf5, 0x3d, 0x11, 0x61, 0xb6, 0xbe, 0xf0, 0xa3, 0x5e, 0xbe, 0x33, 0x5e, 0xa0, 0x3b, 0xf7, 0xba, 0x99, 0x3e, 0x54, 0x8c, 0xeb, 0x3d, 0x7e, 0xdc, 0x2a, 0x3d, 0xf2, 0x6d, 0x01, 0xbe, 0x62, 0xe9, 0x78, 0x3e, 0x89, 0xea, 0x5b, 0x3e, 0x33, 0x60, 0x9e, 0x3e, 0x8f, 0xed, 0x31, 0x3d, 0xd2, 0x74, 0x3b, 0xbe, 0xa4, 0xb5, 0xd0, 0xbd, 0x82, 0xb3, 0x2f, 0xbe, 0x77, 0x61, 0xa1, 0x3e, 0x39, 0x2f, 0xdb, 0xbc, 0xe3, 0xbe, 0xa2, 0xbe, 0x67, 0xa3, 0xc3, 0xbe, 0x47, 0x22, 0xc5, 0x3e, 0x32, 0xf8, 0xe0, 0x3e, 0x54, 0xd2, 0xc5, 0x3c, 0x21, 0x7b, 0xc1, 0xbe, 0x3a, 0x0f, 0x75, 0x3e, 0x12, 0xf7, 0xa6, 0x3e, 0xfd, 0x2f, 0x16, 0x3e, 0xcb, 0x03, 0x84, 0x3a, 0xa3, 0x09, 0xe7, 0x3e, 0x70, 0xaa, 0x93, 0x3e, 0x3a, 0xe3, 0x2b, 0x3e, 0xd3, 0x65, 0xad, 0x3e, 0xf8, 0x41, 0x6b, 0xbe, 0xe8, 0x56, 0x35, 0x3d, 0x91, 0x33, 0x6b, 0xbd, 0x40, 0x30, 0x94, 0xbe, 0x6d, 0x4f, 0x3c, 0xbe, 0x71, 0x3a, 0x3a, 0xbe, 0xd1, 0x71, 0x3b, 0xbe, 0xbc, 0xd8, 0xe5, 0xbe, 0x9b, 0xa7, 0xc1, 0xbe, 0x34, 0x0b, 0xae, 0x3e, 0xd1, 0x9c, 0x22, 0xbc, 0x84, 0xd5, 0xac, 0x3e, 0x30, 0x4e, 0xbb, 0x3d, 0xa4, 0x67, 0x52, 0x3d, 0xbc, 0xb9, 0xc7, 0x3e, 0x9f, 0x12, 0x10, 0xbe, 0x45, 0x59, 0x73, 0xbe, 0xad, 0x8c, 0xdf, 0x3e, 0x43, 0x8e, 0xb1, 0x3e, 0x88, 0x71, 0x74, 0x3e, 0x67, 0x74, 0xbd, 0x3e, 0x9b, 0x26, 0xfe, 0x3d, 0x64, 0xa4, 0x90, 0x3e, 0x7e, 0x5a, 0x2a, 0xbe, 0xc9, 0x94, 0x5f, 0x3e, 0xc4, 0x3b, 0xd3, 0x3e, 0xc1, 0x2c, 0xd8, 0xbd, 0x38, 0x38, 0xae, 0xbd, 0xd7, 0xad, 0xb5, 0xbd, 0x0d, 0x89, 0xf8, 0xbd, 0xb6, 0x10, 0x89, 0x3e, 0xe4, 0xeb, 0x92, 0x3e, 0x72, 0xdd, 0xc8, 0x3e, 0xdc, 0xa4, 0x06, 0xbe, 0x75, 0xcf, 0x2a, 0x3e, 0x8f, 0x23, 0x3d, 0xbe, 0x32, 0x7b, 0xbd, 0xbd, 0x5c, 0x4b, 0xbe, 0x3d, 0x80, 0xf9, 0x93, 0xbe, 0x20, 0xde, 0x46, 0xbe, 0x0a, 0x6f, 0x12, 0xbe, 0x17, 0x0f, 0x5a, 0x3e, 0x9e, 0x37, 0x73, 0xbe, 0xf8, 0x05, 0x65, 0x3e, 0x01, 0x46, 0x7b, 0xbc, 0x61, 0x5c, 0x93, 0x3e, 0x5e, 0x69, 0x30, 0x3e, 0x48, 0x1c, 0xad, 0xbe, 0xb5, 0xae, 0x1a, 0x3e, 0x44, 0x95, 0x89, 0x3e, 0x09, 0x24, 0xae, 0x3d, 0xf8, 0x83, 0x12, 0x3e, 0xd7, 0x38, 0xb3, 0x3d, 0xa7, 0xb7, 0x08, 0x3e, 0x60, 0x13, 0x05, 0x3e, 0x24, 0x58, 0x9c, 0xbe, 0xd2, 0x34, 0x7c, 0xbd, 0xcb, 0x95, 0x99, 0x3e, 0xc3, 0xf0, 0x92, 0xbe, 0x67, 0xfe, 0x2d, 0x3e, 0xb2, 0xe4, 0xde, 0x3e, 0x19, 0x00, 0x78, 0x3d, 0xee, 0xc7, 0x3f, 0xbd, 0x11, 0xf6, 0xb5, 0x3d, 0xc0, 0xcc, 0xe1, 0x3e, 0x37, 0x52, 0x9f, 0x3d, 0x9b, 0xce, 0xe7, 0xbd, 0xd1, 0x8a, 0xb8, 0xbd, 0xdb, 0xba, 0x34, 0xbe, 0x36, 0xac, 0xad, 0x3e, 0x0a, 0xb9, 0x6c, 0xbe, 0x09, 0x9c, 0xcf, 0xbc, 0x77, 0x40, 0x17, 0xbe, 0x51, 0xf8, 0x84, 0x3e, 0x49, 0x7f, 0x1d, 0x3e, 0xc4, 0xf5, 0xd8, 0x3e, 0x89, 0xbe, 0x74, 0x3e, 0xcb, 0x0a, 0x9e, 0x3e, 0xaa, 0x55, 0xb3, 0xbd, 0xaf, 0x0b, 0xbe, 0xbe, 0x64, 0x40, 0xd4, 0x3d, 0xd5, 0x41, 0xfa, 0x3d, 0x6c, 0xb2, 0xe9, 0x3d, 0xdd, 0x94, 0x1f, 0xbb, 0xc4, 0x5c, 0xef, 0x3b, 0x54, 0xfb, 0xc1, 0xbd, 0x66, 0xed, 0x68, 0xbe, 0x31, 0xbe, 0xc0, 0x3e, 0x54, 0x66, 0x8b, 0x3e, 0xe1, 0x5c, 0x35, 0x3e, 0x62, 0x2f, 0xa4, 0x3e, 0x48, 0x8c, 0x5d, 0x3e, 0x6b, 0x5f, 0xd3, 0x3d, 0x35, 0x38, 0x81, 0xbe, 0x43, 0x41, 0x1d, 0x3e, 0x04, 0x91, 0x4c, 0xbe, 0x82, 0x7a, 0xd3, 0xbe, 0xaf, 0x82, 0xbe, 0xbe, 0x84, 0xd0, 0x07, 0x3f, 0x2a, 0xe6, 0xc4, 0x3e, 0x7d, 0x24, 0xc0, 0x3d, 0x26, 0x92, 0x5c, 0xbd, 0x39, 0xe0, 0x34, 0x3e, 0xdd, 0x62, 0x43, 0x3e, 0x3a, 0xaa, 0xab, 0x3d, 0xd6, 0xa1, 0xe4, 0xbd, 0xd1, 0xa6, 0xee, 0x3e, 0x49, 0x81, 0x11, 0xbe, 0x52, 0xae, 0xd2, 0xbe, 0x34, 0xa9, 0x7b, 0xbe, 0x4d, 0xb4, 0x34, 0xbe, 0xbc, 0x37, 0x39, 0x3e, 0x9a, 0xfb, 0x51, 0x3e, 0x9d, 0x23, 0x95, 0xbe, 0x9a, 0xea, 0x2e, 0xbd, 0x91, 0x0f, 0x6a, 0x3e, 0x60, 0x30, 0x96, 0x3e, 0x17, 0xa6, 0xb8, 0xbe, 0x66, 0x93, 0x95, 0xbe, 0xbb, 0xbe, 0x80, 0x3e, 0x14, 0xbb, 0x8f, 0x3d, 0x6a, 0xe6, 0xae, 0x3c, 0xb1, 0x90, 0xb6, 0xbd, 0x54, 0xa3, 0xed, 0x3e, 0xa6, 0xaf, 0x42, 0xbe, 0x69, 0x9a, 0x56, 0xbe, 0xbe, 0xe5, 0x4a, 0x3e, 0x2d, 0x5b, 0xaf, 0x3e, 0xf5, 0x92, 0xbb, 0xbe, 0xe1, 0x25, 0x67, 0xbe, 0xca, 0x2e, 0x86, 0x3e, 0xf8, 0x0d, 0x1c, 0x3e, 0xfe, 0x52, 0x09, 0x3e, 0xb5, 0x30, 0xf6, 0x3d, 0x95, 0x0f, 0xf4, 0xbd, 0xee, 0x8f, 0xf3, 0x3e, 0x63, 0x7c, 0xa5, 0xbd, 0xb8, 0x62, 0x90, 0x3d, 0x7f, 0xc0, 0x01, 0x3f, 0xc6, 0x7c, 0x4b, 0x3d, 0x4b, 0x69, 0x17, 0x3e, 0x71, 0x96, 0x2c, 0xbe, 0x3a, 0xc2, 0x02, 0xbf, 0x26, 0x89, 0x82, 0x3e, 0xd7, 0x01, 0x84, 0xbb, 0xa5, 0x8f, 0x4c, 0x3e, 0x8c, 0x16, 0xae, 0x3d, 0xef, 0xa7, 0x84, 0x3d, 0xd5, 0xe7, 0x49, 0x3e, 0x66, 0x31, 0x84, 0x3e, 0xe4, 0xab, 0xa7, 0xbe, 0xb5, 0x72, 0xc1, 0xbe, 0xb0, 0x2c, 0x8e, 0x3e, 0xb2, 0xbe, 0x83, 0xbe, 0x51, 0xfe, 0x63, 0x3e, 0xa4, 0x95, 0xe6, 0xbd, 0xec, 0x07, 0xb0, 0x3d, 0x2e, 0x22, 0x7c, 0xbd, 0x41, 0xa5, 0x0f, 0x3d, 0xe8, 0xc0, 0x96, 0x3e, 0x24, 0x68, 0xb7, 0xbe, 0xe8, 0xbe, 0xcb, 0x3c, 0x4e, 0xe0, 0x78, 0x3e, 0xad, 0x19, 0x50, 0x3c, 0x63, 0xc7, 0x80, 0xbe, 0x9e, 0x98, 0x8c, 0x3d, 0xa6, 0xc1, 0x96, 0xbe, 0xca, 0x75, 0x95, 0x3e, 0x33, 0x95, 0x04, 0x3e, 0x3a, 0x62, 0xed, 0x3d, 0xee, 0x39, 0x4f, 0xbe, 0xfb, 0xd1, 0x69, 0xbd, 0xf8, 0xa0, 0x86, 0x3e, 0x8d, 0x9e, 0x3e, 0xbe, 0xb1, 0x44, 0x3d, 0xbc, 0x3f, 0x58, 0xba, 0xbe, 0x17, 0x39, 0xb5, 0x3d, 0xff, 0x89, 0x0b, 0x3e, 0x39, 0xa5, 0xaf, 0xbe, 0x0c, 0xcf, 0x47, 0xbe, 0x90, 0xc9, 0xa8, 0x3c, 0x7a, 0x09, 0xe0, 0xbe, 0xf5, 0x6e, 0x3f, 0xbe, 0x96, 0x41, 0x0b, 0xbe, 0x66, 0xe6, 0x7a, 0x3d, 0x7e, 0x52, 0xfd, 0x3c, 0x52, 0x50, 0x9e, 0x3e, 0x87, 0x8a, 0xa9, 0x3e, 0x3c, 0xc8, 0x0c, 0x3e, 0x39, 0x3c, 0xe8, 0xbe, 0xda, 0xe1, 0xed, 0xbd, 0xb5, 0x11, 0x0b, 0x3e, 0xac, 0x90, 0x86, 0xbe, 0x1f, 0x2b, 0x14, 0xbe, 0x49, 0x04, 0xd8, 0x3d, 0xa1, 0x50, 0x99, 0x3e, 0x87, 0xda, 0xc8, 0x3d, 0x4f, 0xb8, 0xc4, 0xbe, 0xaf, 0xe0, 0x16, 0xbe, 0x4a, 0x75, 0xdc, 0x3c, 0x42, 0x8d, 0x5a, 0x3e, 0x3d, 0xd5, 0x5b, 0x3d, 0xe9, 0x99, 0x94, 0x3e, 0x6d, 0xbe, 0x9f, 0x3d, 0xff, 0x4d, 0x31, 0x3d, 0x64, 0xde, 0xfd, 0x3d, 0x69, 0xf2, 0x64, 0x3c, 0x0d, 0x23, 0x04, 0x3d, 0x9b, 0x7a, 0x6b, 0x3e, 0x6b, 0x8b, 0xfa, 0xbd, 0x23, 0xd8, 0x8a, 0xbe, 0x92, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xd1, 0xbe, 0x72, 0x3d, 0x3b, 0x51, 0x1c, 0x3d, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xc8, 0x80, 0x3c, 0xae, 0x33, 0x94, 0xbc, 0x32, 0x16, 0xe3, 0x3c, 0xce, 0x50, 0x51, 0xbd, 0x57, 0x79, 0x79, 0x3c, 0xf7, 0x4b, 0xa0, 0xbc, 0x32, 0x69, 0x62, 0xbd, 0xfe, 0x3c, 0x06, 0xbd, 0x71, 0x38, 0x3a, 0xbc, 0xeb, 0xff, 0x08, 0x3c, 0xf9, 0x6f, 0xa5, 0x3d, 0x9b, 0xde, 0xd2, 0xbc, 0x16, 0x0f, 0x2e, 0x3d, 0xde, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6f, 0x67, 0xe4, 0xbc, 0xee, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xd4, 0xef, 0xff, 0xff, 0xd8, 0xef, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x1c, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0xf6, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x9c, 0xf0, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6a, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0xf1, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xca, 0xfe, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xbe, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa2, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa4, 0xf1, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x44, 0xf2, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0xf3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x98, 0x0c, 0x00, 0x00, 0x44, 0x0c, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0xb4, 0x0b, 0x00, 0x00, 0x60, 0x0b, 0x00, 0x00, 0x20, 0x0b, 0x00, 0x00, 0xe0, 0x0a, 0x00, 0x00, 0x98, 0x0a, 0x00, 0x00, 0x5c, 0x0a, 0x00, 0x00, 0x20, 0x0a, 0x00, 0x00, 0xe0, 0x09, 0x00, 0x00, 0x9c, 0x09, 0x00, 0x00, 0x58, 0x09, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x00, 0xec, 0x06, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x68, 0x05, 0x00, 0x00, 0xe4, 0x04, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0x74, 0x03, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xea, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd0, 0xf3, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x28, 0xf4, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xba, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0xa0, 0xf4, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4a, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x30, 0xf5, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x65, 0x61, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb6, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xa0, 0xf5, 0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x3b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x66, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x54, 0xf6, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x3b, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x42, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x30, 0xf7, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbe, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa8, 0xf7, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31, 0x64, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x32, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0xf8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31, 0x64, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa6, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x94, 0xf8, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31, 0x64, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x26, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0xf9, 0xff, 0xff, 0x63, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x3b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xce, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbc, 0xf9, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x3b, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa2, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x90, 0xfa, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbc, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x94, 0x10, 0xd5, 0x3a, 0xf3, 0x4b, 0xfc, 0x3a, 0x12, 0xb2, 0x1a, 0x3b, 0xd4, 0xa9, 0x1d, 0x3b, 0xc4, 0xe0, 0x27, 0x3b, 0x3e, 0x0d, 0x05, 0x3b, 0x8b, 0xba, 0x16, 0x3b, 0xde, 0xb0, 0x15, 0x3b, 0x77, 0x28, 0x32, 0x3b, 0x62, 0x58, 0x0d, 0x3b, 0xf3, 0xfa, 0x05, 0x3b, 0xec, 0xc2, 0x10, 0x3b, 0x1d, 0xb3, 0x00, 0x3b, 0x00, 0xb1, 0x2f, 0x3b, 0xd2, 0x7b, 0x33, 0x3b, 0x16, 0x95, 0x33, 0x3b, 0xcd, 0x20, 0x2a, 0x3b, 0xc7, 0x13, 0x0c, 0x3b, 0x33, 0x4e, 0xd2, 0x3a, 0xb0, 0x02, 0xed, 0x3a, 0x8b, 0x6a, 0x1a, 0x3b, 0x5e, 0x9f, 0x1c, 0x3b, 0x11, 0xa5, 0x01, 0x3b, 0x0b, 0x11, 0x12, 0x3b, 0xaf, 0xe7, 0x17, 0x3b, 0x22, 0x04, 0x01, 0x3b, 0x1a, 0xd4, 0x12, 0x3b, 0x7b, 0xbf, 0x1d, 0x3b, 0xdd, 0xcb, 0xfd, 0x3a, 0x8f, 0xa0, 0x20, 0x3b, 0x95, 0x56, 0x13, 0x3b, 0x02, 0x3d, 0x02, 0x3b, 0x11, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x56, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x20, 0xfd, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd6, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x60, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x39, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x9a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x98, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xd2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xd0, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x37, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x36, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4c, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x35, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x88, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc4, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x3a, 0x30, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc0, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xcc, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xd8, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46
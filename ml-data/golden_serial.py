@@ -0,0 +1,193 @@
+"""Run the notebook's golden vectors on the ESP32 over Serial.
+
+Sends each window in golden_vectors.csv (exported by the training notebook)
+to the helmet's GOLDEN: commands (SmartHelmet/golden_check.h), then compares
+the model output with the notebook's TFLite output window by window and the
+on-device time with a stored baseline. The baseline records each window's
+output; windows it marks as known mismatches must keep that output, every
+other window must match TFLite. helmet-host-tools/check_model does the same
+checks on the host (make_golden_vectors.py there writes a golden file
+without the notebook).
+
+Usage:
+    python golden_serial.py <port> [--golden golden_vectors.csv]
+                            [--baseline device_baseline.json] [--tol 0.05]
+                            [--max-slowdown 0.25] [--record]
+
+Exits with status 1 if a check fails. The helmet runs the model without
+its spectral gate (runModelCore()) and only on the sent window, so the result
+does not depend on how the helmet moves during the check.
+"""
+
+import argparse
+import csv
+import json
+import os
+import sys
+import time
+
+import serial
+
+MODEL_THRESHOLD = 0.5   # THRESHOLD in ml_crash_detector.cpp
+FEATURES = ['ax', 'ay', 'az', 'gx', 'gy', 'gz']
+REPLY_TIMEOUT_S = 5.0
+
+
+def load_golden(path):
+    """Return a list of windows: {id, label, tflite_out, rows}."""
+    windows = []
+    with open(path, newline='') as f:
+        for row in csv.DictReader(f):
+            window_id = int(row['window'])
+            if not windows or windows[-1]['id'] != window_id:
+                windows.append({
+                    'id': window_id,
+                    'label': int(row['label']),
+                    'tflite_out': float(row['tflite_out']),
+                    'rows': [],
+                })
+            windows[-1]['rows'].append([row[name] for name in FEATURES])
+    return windows
+
+
+def wait_for_reply(ser, window_id):
+    """Read lines until this window's GOLDEN:RESULT or a GOLDEN:ERROR."""
+    deadline = time.time() + REPLY_TIMEOUT_S
+    while time.time() < deadline:
+        line = ser.readline().decode('utf-8', errors='ignore').strip()
+        if line.startswith('GOLDEN:ERROR:'):
+            raise RuntimeError(line[len('GOLDEN:ERROR:'):])
+        if line.startswith('GOLDEN:RESULT:'):
+            reply_id, confidence, micros = line[len('GOLDEN:RESULT:'):].split(',')
+            if int(reply_id) == window_id:
+                return float(confidence), int(micros)
+        # Anything else is the helmet's normal log output
+    raise RuntimeError(f"no reply for window {window_id} (is this a test build with GOLDEN_SERIAL_ENABLED=1?)")
+
+
+def run_window(ser, window):
+    ser.write(b"GOLDEN:BEGIN\n")
+    for values in window['rows']:
+        ser.write(("GOLDEN:ROW:" + ",".join(values) + "\n").encode())
+    ser.write(f"GOLDEN:RUN:{window['id']}\n".encode())
+    return wait_for_reply(ser, window['id'])
+
+
+def check_windows(windows, results, baseline, tol):
+    """Window by window, like check_model: a window must match TFLite unless
+    the baseline lists it as a known mismatch, and a known mismatch must keep
+    its recorded output. Returns (id, output, reference, reason) failures."""
+    known = baseline['windows'] if baseline else {}
+    if not baseline:
+        print("  no baseline: every window must match (record known mismatches with --record)")
+    failures = []
+    for window in windows:
+        out, mismatch = results[window['id']]
+        expected = known.get(str(window['id']))
+        if baseline and expected is None:
+            failures.append((window['id'], out, window['tflite_out'],
+                             "not in the baseline (different golden file? re-record)"))
+        elif expected is None or not expected['mismatch']:
+            if mismatch:
+                failures.append((window['id'], out, window['tflite_out'],
+                                 "matched TFLite in the baseline" if baseline else "does not match TFLite"))
+        elif abs(out - expected['out']) > tol:
+            failures.append((window['id'], out, expected['out'], "known mismatch, but its output moved"))
+        elif not mismatch:
+            print(f"  window {window['id']} now matches TFLite: re-record the baseline")
+    ids = {str(window['id']) for window in windows}
+    for window_id in known:
+        if window_id not in ids:
+            failures.append((window_id, float('nan'), float('nan'), "in the baseline but not in the golden file"))
+    return failures
+
+
+def percentile(values, q):
+    values = sorted(values)
+    idx = q * (len(values) - 1)
+    lo = int(idx)
+    hi = min(lo + 1, len(values) - 1)
+    return values[lo] + (values[hi] - values[lo]) * (idx - lo)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="On-device golden-vector check")
+    parser.add_argument('port')
+    parser.add_argument('--golden', default='golden_vectors.csv')
+    parser.add_argument('--baseline', default='device_baseline.json')
+    parser.add_argument('--tol', type=float, default=0.05)
+    parser.add_argument('--max-slowdown', type=float, default=0.25)
+    parser.add_argument('--record', action='store_true',
+                        help="store this run as the baseline")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.golden):
+        print(f"✗ {args.golden} not found - export it with the notebook's golden vector cell")
+        sys.exit(2)
+    windows = load_golden(args.golden)
+
+    ser = serial.Serial(args.port, 115200, timeout=1)
+    time.sleep(2)  # Wait for connection to establish
+    ser.reset_input_buffer()
+    print(f"✓ Connected to ESP32 on {args.port}, {len(windows)} golden windows")
+
+    results = {}   # window id -> (ESP32 output, mismatch with TFLite)
+    latency_us = []
+    try:
+        for window in windows:
+            confidence, micros = run_window(ser, window)
+            error = abs(confidence - window['tflite_out'])
+            same_side = (confidence >= MODEL_THRESHOLD) == (window['tflite_out'] >= MODEL_THRESHOLD)
+            results[window['id']] = (confidence, error > args.tol or not same_side)
+            latency_us.append(micros)
+    except RuntimeError as e:
+        print(f"✗ ESP32: {e}")
+        sys.exit(2)
+    finally:
+        ser.close()
+
+    p50 = percentile(latency_us, 0.5)
+    p99 = percentile(latency_us, 0.99)
+    baseline = None
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        if not isinstance(baseline.get('windows'), dict):
+            print(f"✗ {args.baseline} has no per-window outputs (older format) - re-record it with --record")
+            sys.exit(2)
+
+    ok = True
+    mismatches = sum(1 for _, mismatch in results.values() if mismatch)
+    print(f"output:  {mismatches}/{len(windows)} windows outside {args.tol} or across {MODEL_THRESHOLD}")
+    if args.record:
+        with open(args.baseline, 'w') as f:
+            json.dump({'windows': {str(window_id): {'out': out, 'mismatch': mismatch}
+                                   for window_id, (out, mismatch) in results.items()},
+                       'p50_us': p50, 'p99_us': p99}, f, indent=2)
+        print(f"latency: p50={p50:.0f} us  p99={p99:.0f} us per window on the ESP32")
+        print(f"✓ Baseline written to {args.baseline} ({mismatches} known mismatches)")
+        return
+
+    failures = check_windows(windows, results, baseline, args.tol)
+    for window_id, out, reference, reason in failures[:10]:
+        print(f"  window {window_id}: ESP32={out:.3f} reference={reference:.3f}  {reason}")
+    if failures:
+        print(f"✗ Output check failed on {len(failures)} windows")
+        ok = False
+
+    print(f"latency: p50={p50:.0f} us  p99={p99:.0f} us per window on the ESP32")
+    if baseline:
+        limit = 1.0 + args.max_slowdown
+        if p50 > baseline['p50_us'] * limit or p99 > baseline['p99_us'] * limit:
+            print(f"✗ Slower than baseline (p50={baseline['p50_us']:.0f} us, p99={baseline['p99_us']:.0f} us,"
+                  f" limit +{args.max_slowdown * 100:.0f}%)")
+            ok = False
+    else:
+        print(f"  no baseline at {args.baseline} (run with --record)")
+
+    print("✓ PASS" if ok else "✗ FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
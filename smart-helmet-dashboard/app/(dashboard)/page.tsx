@@ -63,7 +63,9 @@ export default function Home() {
             }
             break;
           case 'CRASH_CANCELLED':
-            toast.success('Alert cancelled - Low severity', { duration: 4000 });
+            toast.success(event.reason === 'CONTEXT_DOWNGRADE'
+              ? 'Alert withdrawn - Not a crash'
+              : 'Alert cancelled - Low severity', { duration: 4000 });
             break;
           case 'CRASH_CONFIRMED':
             toast.error('High severity - Email sent', { duration: 6000 });